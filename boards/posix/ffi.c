@@ -1,5 +1,6 @@
 #include "ffi.h"
 #include "froth_fmt.h"
+#include "platform.h"
 #include <unistd.h>
 
 /* POSIX board package: stub GPIO + real ms delay.
@@ -32,6 +33,14 @@ FROTH_FFI(prim_ms, "ms", "( n -- )", "Delay n milliseconds") {
   return FROTH_OK;
 }
 
+/* Masked to the non-negative payload range so it always fits a number cell.
+ * Wraps; subtract two readings for an interval. */
+FROTH_FFI(prim_millis, "millis", "( -- n )", "Milliseconds uptime (wraps)") {
+  froth_cell_u_t mask = ((froth_cell_u_t)1 << (FROTH_CELL_SIZE_BITS - 4)) - 1;
+  FROTH_PUSH((froth_cell_t)((froth_cell_u_t)platform_uptime_ms() & mask));
+  return FROTH_OK;
+}
+
 FROTH_BOARD_BEGIN(froth_board_bindings)
 FROTH_BIND(prim_gpio_mode), FROTH_BIND(prim_gpio_write),
-    FROTH_BIND(prim_ms), FROTH_BOARD_END
+    FROTH_BIND(prim_ms), FROTH_BIND(prim_millis), FROTH_BOARD_END
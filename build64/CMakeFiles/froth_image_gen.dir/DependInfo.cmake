@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/boards/posix/ffi.c" "CMakeFiles/froth_image_gen.dir/boards/posix/ffi.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/boards/posix/ffi.c.o.d"
+  "/root/repo/build64/froth_lib_core_aot.c" "CMakeFiles/froth_image_gen.dir/froth_lib_core_aot.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/froth_lib_core_aot.c.o.d"
+  "/root/repo/platforms/posix/platform.c" "CMakeFiles/froth_image_gen.dir/platforms/posix/platform.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/platforms/posix/platform.c.o.d"
+  "/root/repo/src/froth_aot.c" "CMakeFiles/froth_image_gen.dir/src/froth_aot.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_aot.c.o.d"
+  "/root/repo/src/froth_array.c" "CMakeFiles/froth_image_gen.dir/src/froth_array.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_array.c.o.d"
+  "/root/repo/src/froth_body.c" "CMakeFiles/froth_image_gen.dir/src/froth_body.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_body.c.o.d"
+  "/root/repo/src/froth_boot.c" "CMakeFiles/froth_image_gen.dir/src/froth_boot.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_boot.c.o.d"
+  "/root/repo/src/froth_console.c" "CMakeFiles/froth_image_gen.dir/src/froth_console.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_console.c.o.d"
+  "/root/repo/src/froth_crc32.c" "CMakeFiles/froth_image_gen.dir/src/froth_crc32.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_crc32.c.o.d"
+  "/root/repo/src/froth_evaluator.c" "CMakeFiles/froth_image_gen.dir/src/froth_evaluator.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_evaluator.c.o.d"
+  "/root/repo/src/froth_executor.c" "CMakeFiles/froth_image_gen.dir/src/froth_executor.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_executor.c.o.d"
+  "/root/repo/src/froth_ffi.c" "CMakeFiles/froth_image_gen.dir/src/froth_ffi.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_ffi.c.o.d"
+  "/root/repo/src/froth_fmt.c" "CMakeFiles/froth_image_gen.dir/src/froth_fmt.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_fmt.c.o.d"
+  "/root/repo/src/froth_fuse.c" "CMakeFiles/froth_image_gen.dir/src/froth_fuse.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_fuse.c.o.d"
+  "/root/repo/src/froth_gc.c" "CMakeFiles/froth_image_gen.dir/src/froth_gc.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_gc.c.o.d"
+  "/root/repo/src/froth_heap.c" "CMakeFiles/froth_image_gen.dir/src/froth_heap.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_heap.c.o.d"
+  "/root/repo/src/froth_image_gen.c" "CMakeFiles/froth_image_gen.dir/src/froth_image_gen.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_image_gen.c.o.d"
+  "/root/repo/src/froth_intern.c" "CMakeFiles/froth_image_gen.dir/src/froth_intern.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_intern.c.o.d"
+  "/root/repo/src/froth_link.c" "CMakeFiles/froth_image_gen.dir/src/froth_link.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_link.c.o.d"
+  "/root/repo/src/froth_map.c" "CMakeFiles/froth_image_gen.dir/src/froth_map.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_map.c.o.d"
+  "/root/repo/src/froth_mem.c" "CMakeFiles/froth_image_gen.dir/src/froth_mem.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_mem.c.o.d"
+  "/root/repo/src/froth_object.c" "CMakeFiles/froth_image_gen.dir/src/froth_object.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_object.c.o.d"
+  "/root/repo/src/froth_primitives.c" "CMakeFiles/froth_image_gen.dir/src/froth_primitives.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_primitives.c.o.d"
+  "/root/repo/src/froth_reader.c" "CMakeFiles/froth_image_gen.dir/src/froth_reader.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_reader.c.o.d"
+  "/root/repo/src/froth_repl.c" "CMakeFiles/froth_image_gen.dir/src/froth_repl.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_repl.c.o.d"
+  "/root/repo/src/froth_ring.c" "CMakeFiles/froth_image_gen.dir/src/froth_ring.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_ring.c.o.d"
+  "/root/repo/src/froth_slot_table.c" "CMakeFiles/froth_image_gen.dir/src/froth_slot_table.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_slot_table.c.o.d"
+  "/root/repo/src/froth_snapshot.c" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot.c.o.d"
+  "/root/repo/src/froth_snapshot_prims.c" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_prims.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_prims.c.o.d"
+  "/root/repo/src/froth_snapshot_reader.c" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_reader.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_reader.c.o.d"
+  "/root/repo/src/froth_snapshot_writer.c" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_writer.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_writer.c.o.d"
+  "/root/repo/src/froth_stack.c" "CMakeFiles/froth_image_gen.dir/src/froth_stack.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_stack.c.o.d"
+  "/root/repo/src/froth_tbuf.c" "CMakeFiles/froth_image_gen.dir/src/froth_tbuf.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_tbuf.c.o.d"
+  "/root/repo/src/froth_transport.c" "CMakeFiles/froth_image_gen.dir/src/froth_transport.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_transport.c.o.d"
+  "/root/repo/src/froth_verify.c" "CMakeFiles/froth_image_gen.dir/src/froth_verify.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_verify.c.o.d"
+  "/root/repo/src/froth_vm.c" "CMakeFiles/froth_image_gen.dir/src/froth_vm.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_vm.c.o.d"
+  "/root/repo/src/froth_vocab.c" "CMakeFiles/froth_image_gen.dir/src/froth_vocab.c.o" "gcc" "CMakeFiles/froth_image_gen.dir/src/froth_vocab.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build64/froth_lib_core_aot.c" "/root/repo/build64/froth_lib_core.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
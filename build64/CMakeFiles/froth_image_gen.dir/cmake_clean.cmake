@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/froth_image_gen.dir/boards/posix/ffi.c.o"
+  "CMakeFiles/froth_image_gen.dir/boards/posix/ffi.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/froth_lib_core_aot.c.o"
+  "CMakeFiles/froth_image_gen.dir/froth_lib_core_aot.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/platforms/posix/platform.c.o"
+  "CMakeFiles/froth_image_gen.dir/platforms/posix/platform.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_aot.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_aot.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_array.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_array.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_body.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_body.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_boot.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_boot.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_console.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_console.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_crc32.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_crc32.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_evaluator.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_evaluator.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_executor.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_executor.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_ffi.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_ffi.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_fmt.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_fmt.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_fuse.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_fuse.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_gc.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_gc.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_heap.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_heap.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_image_gen.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_image_gen.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_intern.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_intern.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_link.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_link.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_map.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_map.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_mem.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_mem.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_object.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_object.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_primitives.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_primitives.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_reader.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_reader.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_repl.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_repl.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_ring.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_ring.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_slot_table.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_slot_table.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_prims.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_prims.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_reader.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_reader.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_writer.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_snapshot_writer.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_stack.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_stack.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_tbuf.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_tbuf.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_transport.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_transport.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_verify.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_verify.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_vm.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_vm.c.o.d"
+  "CMakeFiles/froth_image_gen.dir/src/froth_vocab.c.o"
+  "CMakeFiles/froth_image_gen.dir/src/froth_vocab.c.o.d"
+  "froth_image_gen"
+  "froth_image_gen.pdb"
+  "froth_lib_core.h"
+  "froth_lib_core_aot.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/froth_image_gen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
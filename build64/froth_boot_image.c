@@ -0,0 +1,196 @@
+/* Generated by froth_image_gen (ADR-071). Do not edit. */
+#include "froth_image.h"
+
+#if FROTH_CELL_SIZE_BITS != 32 || FROTH_HEAP_SIZE != 4096 || FROTH_SLOT_TABLE_SIZE != 128
+#error "boot image was generated for another configuration"
+#endif
+
+const uint8_t froth_boot_image_heap[] = {
+  0x64, 0x65, 0x66, 0x00, 0x67, 0x65, 0x74, 0x00, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x2b, 0x00, 0x2d,
+  0x00, 0x2a, 0x00, 0x2f, 0x6d, 0x6f, 0x64, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x61, 0x6e,
+  0x64, 0x00, 0x6f, 0x72, 0x00, 0x78, 0x6f, 0x72, 0x00, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x00,
+  0x6c, 0x73, 0x68, 0x69, 0x66, 0x74, 0x00, 0x72, 0x73, 0x68, 0x69, 0x66, 0x74, 0x00, 0x65, 0x6d,
+  0x69, 0x74, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x6b, 0x65, 0x79, 0x3f, 0x00, 0x70, 0x61, 0x74, 0x00,
+  0x70, 0x65, 0x72, 0x6d, 0x00, 0x3e, 0x72, 0x00, 0x72, 0x3e, 0x00, 0x72, 0x40, 0x00, 0x63, 0x68,
+  0x6f, 0x6f, 0x73, 0x65, 0x00, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x00, 0x63, 0x61, 0x74, 0x63, 0x68,
+  0x00, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x00, 0x73, 0x2e, 0x6b, 0x65, 0x65, 0x70, 0x00, 0x73, 0x2e,
+  0x65, 0x6d, 0x69, 0x74, 0x00, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x00, 0x73, 0x40, 0x00, 0x73, 0x2e,
+  0x3d, 0x00, 0x6e, 0x3e, 0x73, 0x00, 0x6e, 0x3e, 0x68, 0x65, 0x78, 0x73, 0x00, 0x6e, 0x3e, 0x62,
+  0x69, 0x6e, 0x73, 0x00, 0x73, 0x2e, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x71, 0x2e, 0x6c,
+  0x65, 0x6e, 0x00, 0x71, 0x40, 0x00, 0x61, 0x72, 0x65, 0x6e, 0x61, 0x7b, 0x00, 0x7d, 0x61, 0x72,
+  0x65, 0x6e, 0x61, 0x00, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+  0x00, 0x2e, 0x00, 0x2e, 0x73, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x00, 0x73, 0x65, 0x65, 0x00,
+  0x69, 0x6e, 0x66, 0x6f, 0x00, 0x76, 0x6f, 0x63, 0x61, 0x62, 0x00, 0x75, 0x73, 0x69, 0x6e, 0x67,
+  0x00, 0x6f, 0x6e, 0x6c, 0x79, 0x00, 0x76, 0x6f, 0x63, 0x61, 0x62, 0x2e, 0x77, 0x6f, 0x72, 0x64,
+  0x73, 0x00, 0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x6f, 0x75, 0x73, 0x2d, 0x72, 0x65, 0x73, 0x65,
+  0x74, 0x00, 0x67, 0x70, 0x69, 0x6f, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x67, 0x70, 0x69, 0x6f,
+  0x2e, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x6d, 0x73, 0x00, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x73,
+  0x00, 0x73, 0x61, 0x76, 0x65, 0x00, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x00, 0x77, 0x69,
+  0x70, 0x65, 0x00, 0x67, 0x63, 0x00, 0x6d, 0x65, 0x6d, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00,
+  0x61, 0x72, 0x72, 0x2e, 0x6e, 0x65, 0x77, 0x00, 0x61, 0x72, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x00,
+  0x61, 0x72, 0x72, 0x40, 0x00, 0x61, 0x72, 0x72, 0x21, 0x00, 0x61, 0x72, 0x72, 0x2e, 0x66, 0x69,
+  0x6c, 0x6c, 0x00, 0x61, 0x72, 0x72, 0x2e, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x61, 0x72, 0x72, 0x2e,
+  0x65, 0x61, 0x63, 0x68, 0x00, 0x61, 0x72, 0x72, 0x2e, 0x67, 0x72, 0x6f, 0x77, 0x00, 0x6d, 0x61,
+  0x70, 0x2e, 0x6e, 0x65, 0x77, 0x00, 0x6d, 0x61, 0x70, 0x2e, 0x6c, 0x65, 0x6e, 0x00, 0x6d, 0x61,
+  0x70, 0x40, 0x00, 0x6d, 0x61, 0x70, 0x21, 0x00, 0x6d, 0x61, 0x70, 0x3f, 0x00, 0x6d, 0x61, 0x70,
+  0x2e, 0x64, 0x65, 0x6c, 0x00, 0x6d, 0x61, 0x70, 0x2e, 0x65, 0x61, 0x63, 0x68, 0x00, 0x72, 0x69,
+  0x6e, 0x67, 0x2e, 0x6e, 0x65, 0x77, 0x00, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x70, 0x75, 0x73, 0x68,
+  0x00, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x70, 0x6f, 0x70, 0x00, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x70,
+  0x65, 0x65, 0x6b, 0x00, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6c, 0x65, 0x6e, 0x00, 0x72, 0x69, 0x6e,
+  0x67, 0x2e, 0x73, 0x75, 0x6d, 0x00, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x69, 0x6e, 0x00, 0x72,
+  0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x78, 0x00, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x61, 0x76, 0x67,
+  0x00, 0x72, 0x6f, 0x74, 0x00, 0x2d, 0x72, 0x6f, 0x74, 0x00, 0x6e, 0x69, 0x70, 0x00, 0x74, 0x75,
+  0x63, 0x6b, 0x00, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x00, 0x63, 0x72, 0x00, 0x64, 0x75, 0x70,
+  0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x8b, 0x11, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x73, 0x77, 0x61, 0x70, 0x00, 0x02, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4b, 0x12, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x64, 0x72, 0x6f, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x6f, 0x76, 0x65, 0x72, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xcb, 0x13, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x69, 0x66, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x74, 0x72, 0x79, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xa7, 0x2e, 0x00, 0x00,
+  0xf6, 0x02, 0x00, 0x00, 0x73, 0x65, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x64, 0x69, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x65, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00, 0x62, 0x69, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbe, 0x02, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0xb6, 0x02, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x74, 0x69, 0x6d, 0x65, 0x73, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe6, 0x02, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0xc1, 0x18, 0x00, 0x00, 0x41, 0x19, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0xf6, 0x02, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xf6, 0x02, 0x00, 0x00, 0x61, 0x62, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xe6, 0x02, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x00, 0x00,
+  0x41, 0x1b, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x61, 0x75, 0x74, 0x6f, 0x72, 0x75, 0x6e, 0x00,
+};
+const froth_cell_u_t froth_boot_image_heap_size = 912;
+
+const froth_image_slot_t froth_boot_image_slots[] = {
+  {0, 0},
+  {4, 0},
+  {8, 0},
+  {13, 0},
+  {15, 0},
+  {17, 0},
+  {19, 0},
+  {24, 0},
+  {26, 0},
+  {28, 0},
+  {30, 0},
+  {34, 0},
+  {37, 0},
+  {41, 0},
+  {48, 0},
+  {55, 0},
+  {62, 0},
+  {67, 0},
+  {71, 0},
+  {76, 0},
+  {80, 0},
+  {85, 0},
+  {88, 0},
+  {91, 0},
+  {94, 0},
+  {101, 0},
+  {107, 0},
+  {113, 0},
+  {119, 0},
+  {126, 0},
+  {133, 0},
+  {139, 0},
+  {142, 0},
+  {146, 0},
+  {150, 0},
+  {157, 0},
+  {164, 0},
+  {173, 0},
+  {179, 0},
+  {182, 0},
+  {189, 0},
+  {196, 0},
+  {201, 0},
+  {209, 0},
+  {211, 0},
+  {214, 0},
+  {220, 0},
+  {224, 0},
+  {229, 0},
+  {235, 0},
+  {241, 0},
+  {246, 0},
+  {258, 0},
+  {274, 0},
+  {284, 0},
+  {295, 0},
+  {298, 0},
+  {305, 0},
+  {310, 0},
+  {318, 0},
+  {323, 0},
+  {326, 0},
+  {336, 0},
+  {344, 0},
+  {352, 0},
+  {357, 0},
+  {362, 0},
+  {371, 0},
+  {380, 0},
+  {389, 0},
+  {398, 0},
+  {406, 0},
+  {414, 0},
+  {419, 0},
+  {424, 0},
+  {429, 0},
+  {437, 0},
+  {446, 0},
+  {455, 0},
+  {465, 0},
+  {474, 0},
+  {484, 0},
+  {493, 0},
+  {502, 0},
+  {511, 0},
+  {520, 0},
+  {529, 0},
+  {533, 0},
+  {538, 0},
+  {542, 0},
+  {547, 0},
+  {554, 0},
+  {557, 4513},
+  {580, 4705},
+  {604, 4897},
+  {628, 5121},
+  {656, 5281},
+  {672, 5409},
+  {692, 5569},
+  {708, 5697},
+  {732, 5921},
+  {760, 6113},
+  {784, 6625},
+  {860, 7009},
+  {904, 0},
+};
+const froth_cell_u_t froth_boot_image_slot_count = 105;
+
+const froth_cell_t froth_boot_image_interned[] = {
+  7009,
+  5067,
+  4897,
+  6977,
+  5569,
+  6913,
+  5121,
+  6337,
+  4705,
+  5281,
+  6465,
+  4683,
+  6625,
+  5409,
+  5921,
+  5697,
+};
+const froth_cell_u_t froth_boot_image_interned_count = 16;
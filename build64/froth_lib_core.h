@@ -0,0 +1,6 @@
+#include "froth_aot.h"
+extern const froth_ffi_entry_t froth_lib_core_aot[];
+extern const froth_native_word_t froth_lib_core_aot_exact[];
+#ifndef FROTH_BOOT_IMAGE
+static const char froth_lib_core[] = {0x5c, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x20, 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x53, 0x68, 0x75, 0x66, 0x66, 0x6c, 0x65, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x5c, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x2e, 0x0a, 0x5c, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x3a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x73, 0x61, 0x79, 0x73, 0x20, 0x68, 0x6f, 0x77, 0x0a, 0x5c, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x73, 0x61, 0x79, 0x73, 0x0a, 0x5c, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x2e, 0x20, 0x4c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x74, 0x6f, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x0a, 0x5c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x64, 0x65, 0x65, 0x70, 0x65, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x73, 0x74, 0x2e, 0x0a, 0x0a, 0x5c, 0x20, 0x44, 0x75, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x2d, 0x2d, 0x20, 0x61, 0x20, 0x61, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x35, 0x20, 0x64, 0x75, 0x70, 0x20, 0x3d, 0x3e, 0x20, 0x35, 0x20, 0x35, 0x0a, 0x3a, 0x20, 0x64, 0x75, 0x70, 0x20, 0x28, 0x20, 0x61, 0x20, 0x2d, 0x2d, 0x20, 0x61, 0x20, 0x61, 0x20, 0x29, 0x20, 0x20, 0x20, 0x31, 0x20, 0x70, 0x5b, 0x61, 0x20, 0x61, 0x5d, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x53, 0x77, 0x61, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x2d, 0x2d, 0x20, 0x62, 0x20, 0x61, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x3d, 0x3e, 0x20, 0x32, 0x20, 0x31, 0x0a, 0x3a, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x2d, 0x2d, 0x20, 0x62, 0x20, 0x61, 0x20, 0x29, 0x20, 0x20, 0x20, 0x32, 0x20, 0x70, 0x5b, 0x61, 0x20, 0x62, 0x5d, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x44, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x3d, 0x3e, 0x20, 0x31, 0x0a, 0x3a, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x28, 0x20, 0x61, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x20, 0x20, 0x20, 0x31, 0x20, 0x70, 0x5b, 0x5d, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x2d, 0x2d, 0x20, 0x61, 0x20, 0x62, 0x20, 0x61, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x31, 0x20, 0x32, 0x20, 0x31, 0x0a, 0x3a, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x2d, 0x2d, 0x20, 0x61, 0x20, 0x62, 0x20, 0x61, 0x20, 0x29, 0x20, 0x20, 0x20, 0x32, 0x20, 0x70, 0x5b, 0x62, 0x20, 0x61, 0x20, 0x62, 0x5d, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x52, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x63, 0x20, 0x2d, 0x2d, 0x20, 0x62, 0x20, 0x63, 0x20, 0x61, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x72, 0x6f, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x32, 0x20, 0x33, 0x20, 0x31, 0x0a, 0x0a, 0x0a, 0x5c, 0x20, 0x52, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x3a, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x67, 0x6f, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x63, 0x20, 0x2d, 0x2d, 0x20, 0x63, 0x20, 0x61, 0x20, 0x62, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x2d, 0x72, 0x6f, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x33, 0x20, 0x31, 0x20, 0x32, 0x0a, 0x0a, 0x0a, 0x5c, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x2d, 0x2d, 0x20, 0x62, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x6e, 0x69, 0x70, 0x20, 0x3d, 0x3e, 0x20, 0x32, 0x0a, 0x0a, 0x0a, 0x5c, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x62, 0x20, 0x2d, 0x2d, 0x20, 0x62, 0x20, 0x61, 0x20, 0x62, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x74, 0x75, 0x63, 0x6b, 0x20, 0x3d, 0x3e, 0x20, 0x32, 0x20, 0x31, 0x20, 0x32, 0x0a, 0x0a, 0x0a, 0x5c, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x46, 0x6c, 0x6f, 0x77, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x5c, 0x20, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x65, 0x73, 0x2e, 0x0a, 0x5c, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x5c, 0x20, 0x69, 0x66, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x2c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 0x66, 0x2d, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x2d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x5b, 0x20, 0x31, 0x30, 0x20, 0x5d, 0x20, 0x5b, 0x20, 0x32, 0x30, 0x20, 0x5d, 0x20, 0x69, 0x66, 0x20, 0x3d, 0x3e, 0x20, 0x31, 0x30, 0x0a, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x74, 0x20, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x29, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x2e, 0x0a, 0x5c, 0x20, 0x44, 0x72, 0x6f, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x2e, 0x2e, 0x2e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x5b, 0x20, 0x31, 0x32, 0x33, 0x20, 0x5d, 0x20, 0x74, 0x72, 0x79, 0x20, 0x3d, 0x3e, 0x20, 0x31, 0x32, 0x33, 0x20, 0x2d, 0x31, 0x0a, 0x3a, 0x20, 0x74, 0x72, 0x79, 0x20, 0x28, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x2e, 0x2e, 0x2e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x29, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x20, 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x5c, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x0a, 0x5c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x20, 0x64, 0x75, 0x70, 0x2f, 0x73, 0x77, 0x61, 0x70, 0x2f, 0x72, 0x6f, 0x74, 0x0a, 0x5c, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x64, 0x69, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x20, 0x46, 0x72, 0x6f, 0x74, 0x68, 0x2e, 0x0a, 0x0a, 0x5c, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x27, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x34, 0x32, 0x20, 0x27, 0x78, 0x20, 0x73, 0x65, 0x74, 0x0a, 0x3a, 0x20, 0x73, 0x65, 0x74, 0x20, 0x28, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x27, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x20, 0x20, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x64, 0x65, 0x66, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x54, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x69, 0x6c, 0x79, 0x20, 0x68, 0x69, 0x64, 0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x5c, 0x20, 0x53, 0x74, 0x61, 0x73, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x5c, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x73, 0x68, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x61, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x31, 0x20, 0x32, 0x20, 0x5b, 0x20, 0x31, 0x30, 0x20, 0x2b, 0x20, 0x5d, 0x20, 0x64, 0x69, 0x70, 0x20, 0x3d, 0x3e, 0x20, 0x31, 0x32, 0x20, 0x32, 0x0a, 0x3a, 0x20, 0x64, 0x69, 0x70, 0x20, 0x28, 0x20, 0x61, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x61, 0x20, 0x29, 0x20, 0x20, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x3e, 0x72, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x72, 0x3e, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x2e, 0x0a, 0x5c, 0x20, 0x43, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x2c, 0x0a, 0x5c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x70, 0x75, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x70, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x78, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x78, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x35, 0x20, 0x5b, 0x20, 0x32, 0x20, 0x2a, 0x20, 0x5d, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x3d, 0x3e, 0x20, 0x31, 0x30, 0x20, 0x35, 0x0a, 0x3a, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x28, 0x20, 0x78, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x78, 0x20, 0x29, 0x20, 0x20, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x5c, 0x20, 0x52, 0x75, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x20, 0x78, 0x20, 0x28, 0x6b, 0x65, 0x65, 0x70, 0x69, 0x6e, 0x67, 0x20, 0x78, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x0a, 0x5c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x20, 0x78, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x78, 0x20, 0x66, 0x20, 0x67, 0x20, 0x2d, 0x2d, 0x20, 0x66, 0x28, 0x78, 0x29, 0x20, 0x67, 0x28, 0x78, 0x29, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x35, 0x20, 0x5b, 0x20, 0x32, 0x20, 0x2a, 0x20, 0x5d, 0x20, 0x5b, 0x20, 0x31, 0x20, 0x2b, 0x20, 0x5d, 0x20, 0x62, 0x69, 0x20, 0x3d, 0x3e, 0x20, 0x31, 0x30, 0x20, 0x36, 0x0a, 0x3a, 0x20, 0x62, 0x69, 0x20, 0x28, 0x20, 0x78, 0x20, 0x66, 0x20, 0x67, 0x20, 0x2d, 0x2d, 0x20, 0x66, 0x28, 0x78, 0x29, 0x20, 0x67, 0x28, 0x78, 0x29, 0x20, 0x29, 0x20, 0x20, 0x20, 0x2d, 0x72, 0x6f, 0x74, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x72, 0x6f, 0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x6e, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x2e, 0x0a, 0x5c, 0x20, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x6e, 0x65, 0x75, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x28, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x3a, 0x20, 0x69, 0x74, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x0a, 0x5c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x0a, 0x5c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x69, 0x74, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6b, 0x65, 0x70, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x5c, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x61, 0x73, 0x68, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x73, 0x6f, 0x20, 0x69, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x6e, 0x27, 0x74, 0x0a, 0x5c, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x65, 0x72, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x6e, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x33, 0x20, 0x5b, 0x20, 0x34, 0x32, 0x20, 0x2e, 0x20, 0x5d, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x3e, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x22, 0x34, 0x32, 0x20, 0x34, 0x32, 0x20, 0x34, 0x32, 0x20, 0x22, 0x0a, 0x3a, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x28, 0x20, 0x6e, 0x20, 0x71, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x3e, 0x72, 0x0a, 0x20, 0x20, 0x5b, 0x20, 0x64, 0x75, 0x70, 0x20, 0x30, 0x20, 0x3e, 0x20, 0x5d, 0x20, 0x5b, 0x20, 0x31, 0x20, 0x2d, 0x20, 0x72, 0x40, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x5d, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x72, 0x3e, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x0a, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x20, 0x41, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x65, 0x74, 0x69, 0x63, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x5c, 0x20, 0x4e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x3a, 0x20, 0x66, 0x6c, 0x69, 0x70, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x2d, 0x2d, 0x20, 0x2d, 0x61, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x35, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x2d, 0x35, 0x0a, 0x0a, 0x0a, 0x5c, 0x20, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2c, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x20, 0x69, 0x74, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x61, 0x20, 0x2d, 0x2d, 0x20, 0x7c, 0x61, 0x7c, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x2d, 0x35, 0x20, 0x61, 0x62, 0x73, 0x20, 0x3d, 0x3e, 0x20, 0x35, 0x0a, 0x3a, 0x20, 0x61, 0x62, 0x73, 0x20, 0x28, 0x20, 0x61, 0x20, 0x2d, 0x2d, 0x20, 0x7c, 0x61, 0x7c, 0x20, 0x29, 0x20, 0x20, 0x20, 0x64, 0x75, 0x70, 0x20, 0x30, 0x20, 0x3c, 0x20, 0x5b, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x20, 0x5d, 0x20, 0x5b, 0x20, 0x5d, 0x20, 0x69, 0x66, 0x20, 0x3b, 0x0a, 0x0a, 0x5c, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x20, 0x49, 0x2f, 0x4f, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x5c, 0x20, 0x45, 0x6d, 0x69, 0x74, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2e, 0x0a, 0x5c, 0x20, 0x28, 0x20, 0x2d, 0x2d, 0x20, 0x29, 0x0a, 0x5c, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x34, 0x32, 0x20, 0x2e, 0x20, 0x63, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x22, 0x34, 0x32, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x0a, 0x00};
+#endif
@@ -0,0 +1,63 @@
+/* Generated by cmake/compile_froth.cmake from core.froth. */
+
+#include "froth_aot.h"
+
+froth_error_t froth_prim_sub(froth_vm_t *froth_vm);
+froth_error_t froth_prim_emit(froth_vm_t *froth_vm);
+
+/* : rot ( a b c -- b c a ) */
+static froth_error_t aot_rot(froth_vm_t *vm) {
+  FROTH_TRY(froth_perm_apply(vm, 3, (const uint8_t[]){3, 1, 0, 2}));
+  return FROTH_OK;
+}
+
+/* : -rot ( a b c -- c a b ) */
+static froth_error_t aot__rot(froth_vm_t *vm) {
+  FROTH_TRY(froth_perm_apply(vm, 3, (const uint8_t[]){3, 0, 2, 1}));
+  return FROTH_OK;
+}
+
+/* : nip ( a b -- b ) */
+static froth_error_t aot_nip(froth_vm_t *vm) {
+  FROTH_TRY(froth_perm_apply(vm, 2, (const uint8_t[]){1, 0}));
+  return FROTH_OK;
+}
+
+/* : tuck ( a b -- b a b ) */
+static froth_error_t aot_tuck(froth_vm_t *vm) {
+  FROTH_TRY(froth_perm_apply(vm, 2, (const uint8_t[]){3, 0, 1, 0}));
+  return FROTH_OK;
+}
+
+/* : negate ( a -- -a ) */
+static froth_error_t aot_negate(froth_vm_t *vm) {
+  FROTH_TRY(froth_push(vm, 0));
+  FROTH_TRY(froth_perm_apply(vm, 2, (const uint8_t[]){2, 0, 1}));
+  FROTH_TRY(froth_prim_sub(vm));
+  return FROTH_OK;
+}
+
+/* : cr ( -- ) */
+static froth_error_t aot_cr(froth_vm_t *vm) {
+  FROTH_TRY(froth_push(vm, 10));
+  FROTH_TRY(froth_prim_emit(vm));
+  return FROTH_OK;
+}
+
+const froth_ffi_entry_t froth_lib_core_aot[] = {
+    {"rot", aot_rot, "( a b c -- b c a )", "Compiled from core.froth"},
+    {"-rot", aot__rot, "( a b c -- c a b )", "Compiled from core.froth"},
+    {"nip", aot_nip, "( a b -- b )", "Compiled from core.froth"},
+    {"tuck", aot_tuck, "( a b -- b a b )", "Compiled from core.froth"},
+    {"negate", aot_negate, "( a -- -a )", "Compiled from core.froth"},
+    {"cr", aot_cr, "( -- )", "Compiled from core.froth"},
+    {0}};
+
+const froth_native_word_t froth_lib_core_aot_exact[] = {
+    aot_rot,
+    aot__rot,
+    aot_nip,
+    aot_tuck,
+    aot_negate,
+    aot_cr,
+    NULL};
@@ -0,0 +1,660 @@
+# Build-time compiler for selected Froth definitions (ADR-056).
+#
+#   cmake -DINPUT=core.froth -DOUTPUT=froth_lib_core.h
+#         -DSOURCE=froth_lib_core_aot.c -DVARNAME=froth_lib_core
+#         -DWORDS=rot,-rot -DPRIMITIVES=src/froth_primitives.c
+#         [-DCONTEXT=other.froth,...] -P compile_froth.cmake
+#
+# Every `: name ... ;` in INPUT whose name is listed in WORDS becomes a C
+# function in SOURCE, registered through `<VARNAME>_aot[]` (froth_aot.h).
+# The rest of INPUT is embedded in OUTPUT as `<VARNAME>[]`, as
+# embed_froth.cmake does, except in FROTH_BOOT_IMAGE builds, which boot
+# from the evaluated image instead (ADR-071). Shuffles defined in CONTEXT
+# files may be inlined.
+#
+# A compiled body may contain numbers, words and `[ cond ] [ body ] while`.
+# Kernel primitives and earlier compiled words of the same file are called
+# directly, `n pat perm` and words defined as one are inlined, and any
+# other word is looked up by name when the body runs.
+
+cmake_minimum_required(VERSION 3.18)
+
+foreach(arg INPUT OUTPUT SOURCE VARNAME PRIMITIVES)
+  if(NOT DEFINED ${arg})
+    message(FATAL_ERROR "compile_froth.cmake: ${arg} is required")
+  endif()
+endforeach()
+
+string(REPLACE "," ";" aot_words "${WORDS}")
+string(REPLACE "," ";" context_files "${CONTEXT}")
+get_filename_component(input_name "${INPUT}" NAME)
+
+# Kernel primitives that can rebind words or run arbitrary code. A body
+# that uses one has no checked stack effect.
+set(control_prims call while catch def dangerous-reset perm)
+
+# --- Tokenizer ---------------------------------------------------------------
+
+# Split Froth source into tokens as src/froth_reader.c does, dropping
+# comments. Brackets, ";" and strings are stored as <OPEN>, <PAT>, <CLOSE>
+# and <STR> so that they survive CMake lists. Sets <prefix>_tokens and the
+# byte range of each token in <prefix>_starts and <prefix>_ends.
+function(froth_tokenize file text prefix)
+  string(LENGTH "${text}" len)
+  set(tokens "")
+  set(starts "")
+  set(ends "")
+  set(pos 0)
+  while(pos LESS len)
+    string(SUBSTRING "${text}" ${pos} 1 c)
+    set(start ${pos})
+    math(EXPR pos "${pos} + 1")
+
+    if(c MATCHES "^[ \t\r\n]$")
+      continue()
+    elseif(c STREQUAL "\\")
+      string(SUBSTRING "${text}" ${pos} -1 rest)
+      string(FIND "${rest}" "\n" nl)
+      if(nl EQUAL -1)
+        set(pos ${len})
+      else()
+        math(EXPR pos "${pos} + ${nl}")
+      endif()
+      continue()
+    elseif(c STREQUAL "(")
+      set(depth 1)
+      while(depth GREATER 0)
+        if(NOT pos LESS len)
+          message(FATAL_ERROR "${file}: unterminated comment")
+        endif()
+        string(SUBSTRING "${text}" ${pos} 1 c)
+        math(EXPR pos "${pos} + 1")
+        if(c STREQUAL "(")
+          math(EXPR depth "${depth} + 1")
+        elseif(c STREQUAL ")")
+          math(EXPR depth "${depth} - 1")
+        endif()
+      endwhile()
+      continue()
+    elseif(c STREQUAL ")")
+      message(FATAL_ERROR "${file}: unexpected ')'")
+    elseif(c STREQUAL "\"")
+      set(token "<STR>")
+      set(escaped FALSE)
+      while(TRUE)
+        if(NOT pos LESS len)
+          message(FATAL_ERROR "${file}: unterminated string")
+        endif()
+        string(SUBSTRING "${text}" ${pos} 1 c)
+        math(EXPR pos "${pos} + 1")
+        if(escaped)
+          set(escaped FALSE)
+        elseif(c STREQUAL "\\")
+          set(escaped TRUE)
+        elseif(c STREQUAL "\"")
+          break()
+        endif()
+      endwhile()
+    elseif(c STREQUAL "[")
+      set(token "<OPEN>")
+    elseif(c STREQUAL "]" OR c STREQUAL ";")
+      set(token "<CLOSE>")
+    else()
+      string(SUBSTRING "${text}" ${start} 2 pair)
+      if(pair STREQUAL "p[")
+        set(token "<PAT>")
+        set(pos ${start})
+        math(EXPR pos "${pos} + 2")
+      else()
+        # A tick is a delimiter, so the word starts after it.
+        set(word_start ${start})
+        if(c STREQUAL "'")
+          set(word_start ${pos})
+        endif()
+        string(SUBSTRING "${text}" ${word_start} 64 chunk)
+        string(REGEX MATCH "^[^][;()\"' \t\r\n]*" word "${chunk}")
+        string(LENGTH "${word}" word_len)
+        math(EXPR pos "${word_start} + ${word_len}")
+        if(c STREQUAL "'")
+          set(token "'${word}")
+        else()
+          set(token "${word}")
+        endif()
+      endif()
+    endif()
+
+    list(APPEND tokens "${token}")
+    list(APPEND starts ${start})
+    list(APPEND ends ${pos})
+  endwhile()
+
+  set(${prefix}_tokens "${tokens}" PARENT_SCOPE)
+  set(${prefix}_starts "${starts}" PARENT_SCOPE)
+  set(${prefix}_ends "${ends}" PARENT_SCOPE)
+endfunction()
+
+# Index after the bracket that closes the one opened just before first.
+function(froth_find_close tokens first out)
+  list(LENGTH tokens n)
+  set(depth 1)
+  set(i ${first})
+  while(i LESS n)
+    list(GET tokens ${i} tok)
+    math(EXPR i "${i} + 1")
+    if(tok STREQUAL "<OPEN>" OR tok STREQUAL "<PAT>")
+      math(EXPR depth "${depth} + 1")
+    elseif(tok STREQUAL "<CLOSE>")
+      math(EXPR depth "${depth} - 1")
+      if(depth EQUAL 0)
+        set(${out} ${i} PARENT_SCOPE)
+        return()
+      endif()
+    endif()
+  endwhile()
+  set(${out} -1 PARENT_SCOPE)
+endfunction()
+
+# --- Definitions -------------------------------------------------------------
+
+# Collect the top-level `: name ... ;` definitions of a tokenized file. For
+# definition k: <prefix>_def_<k>_{name,first,last,start,end,effect}, where
+# first..last-1 are the body tokens and start..end the source text.
+function(froth_collect_defs file text prefix)
+  set(tokens "${${prefix}_tokens}")
+  list(LENGTH tokens n)
+  set(names "")
+  set(k 0)
+  set(depth 0)
+  set(i 0)
+  while(i LESS n)
+    list(GET tokens ${i} tok)
+    if(tok STREQUAL "<OPEN>" OR tok STREQUAL "<PAT>")
+      math(EXPR depth "${depth} + 1")
+    elseif(tok STREQUAL "<CLOSE>")
+      math(EXPR depth "${depth} - 1")
+    elseif(tok STREQUAL ":" AND depth EQUAL 0)
+      math(EXPR name_i "${i} + 1")
+      math(EXPR first "${i} + 2")
+      if(NOT first LESS n)
+        message(FATAL_ERROR "${file}: ':' without a definition")
+      endif()
+      list(GET tokens ${name_i} name)
+      froth_find_close("${tokens}" ${first} end_i)
+      if(end_i EQUAL -1)
+        message(FATAL_ERROR "${file}: unterminated definition of '${name}'")
+      endif()
+      math(EXPR last "${end_i} - 1")
+
+      # The text between the name and the body holds the effect comment.
+      list(GET ${prefix}_ends ${name_i} name_end)
+      list(GET ${prefix}_starts ${first} body_start)
+      math(EXPR gap "${body_start} - ${name_end}")
+      string(SUBSTRING "${text}" ${name_end} ${gap} effect)
+      string(REGEX REPLACE "[ \t\r\n]+" " " effect "${effect}")
+      string(STRIP "${effect}" effect)
+
+      list(GET ${prefix}_starts ${i} start)
+      math(EXPR close_i "${end_i} - 1")
+      list(GET ${prefix}_ends ${close_i} end)
+
+      list(APPEND names "${name}")
+      foreach(field name first last start end effect)
+        set(${prefix}_def_${k}_${field} "${${field}}" PARENT_SCOPE)
+      endforeach()
+      math(EXPR k "${k} + 1")
+      set(i ${end_i})
+      continue()
+    endif()
+    math(EXPR i "${i} + 1")
+  endwhile()
+  set(${prefix}_def_names "${names}" PARENT_SCOPE)
+endfunction()
+
+# Match `n p[ ... ] perm` at token i. Sets <out>_next to the index after it
+# (-1 if there is no match) and <out>_bytes to the C pattern initializer:
+# the length, then each index with 0 for the top of the window.
+function(froth_match_perm tokens i end out)
+  set(${out}_next -1 PARENT_SCOPE)
+  math(EXPR pat_i "${i} + 1")
+  if(NOT pat_i LESS end)
+    return()
+  endif()
+  list(GET tokens ${i} n)
+  list(GET tokens ${pat_i} pat)
+  if(NOT n MATCHES "^[0-9]+$" OR NOT pat STREQUAL "<PAT>")
+    return()
+  endif()
+
+  set(bytes "")
+  set(count 0)
+  math(EXPR j "${i} + 2")
+  while(j LESS end)
+    list(GET tokens ${j} item)
+    math(EXPR j "${j} + 1")
+    if(item STREQUAL "<CLOSE>")
+      break()
+    elseif(item MATCHES "^[a-z]$")
+      string(FIND "abcdefghijklmnopqrstuvwxyz" "${item}" index)
+    elseif(item MATCHES "^[0-9]+$" AND item LESS 256)
+      set(index ${item})
+    else()
+      return()
+    endif()
+    string(APPEND bytes ", ${index}")
+    math(EXPR count "${count} + 1")
+  endwhile()
+  if(NOT j LESS end)
+    return()
+  endif()
+  list(GET tokens ${j} word)
+  if(NOT word STREQUAL "perm")
+    return()
+  endif()
+
+  math(EXPR next "${j} + 1")
+  set(${out}_next ${next} PARENT_SCOPE)
+  set(${out}_n ${n} PARENT_SCOPE)
+  set(${out}_take ${n} PARENT_SCOPE)
+  set(${out}_give ${count} PARENT_SCOPE)
+  set(${out}_bytes "${count}${bytes}" PARENT_SCOPE)
+endfunction()
+
+# Words whose whole body is one `n pat perm`, from one tokenized file. A
+# name defined twice is left out: it is called by name instead.
+function(froth_collect_shuffles prefix)
+  set(names "")
+  set(seen "")
+  set(k 0)
+  foreach(name IN LISTS ${prefix}_def_names)
+    math(EXPR next_k "${k} + 1")
+    list(FIND seen "${name}" dup)
+    list(APPEND seen "${name}")
+    if(NOT dup EQUAL -1)
+      list(REMOVE_ITEM names "${name}")
+    else()
+      froth_match_perm("${${prefix}_tokens}" ${${prefix}_def_${k}_first}
+                       ${${prefix}_def_${k}_last} perm)
+      if(perm_next EQUAL ${prefix}_def_${k}_last)
+        list(APPEND names "${name}")
+        set(shuffle_${prefix}_${name}_n ${perm_n} PARENT_SCOPE)
+        set(shuffle_${prefix}_${name}_give ${perm_give} PARENT_SCOPE)
+        set(shuffle_${prefix}_${name}_bytes "${perm_bytes}" PARENT_SCOPE)
+      endif()
+    endif()
+    set(k ${next_k})
+  endforeach()
+  set(${prefix}_shuffles "${names}" PARENT_SCOPE)
+endfunction()
+
+# --- Stack effects -----------------------------------------------------------
+
+# Count "( a b -- c )" with an optional "( R: a -- b )" group. <out>_ok is
+# FALSE for "...", nested parentheses or anything else unexpected.
+function(froth_parse_effect decl out)
+  set(${out}_ok FALSE PARENT_SCOPE)
+  if(NOT decl MATCHES "^\\([^()]*\\)( \\( R:[^()]*\\))?$")
+    return()
+  endif()
+  string(REGEX MATCHALL "\\([^()]*\\)" groups "${decl}")
+  set(fields ds rs)
+  foreach(group IN LISTS groups)
+    list(POP_FRONT fields field)
+    string(REGEX REPLACE "^\\((R:)?(.*)\\)$" "\\2" inner "${group}")
+    string(REGEX MATCHALL "[^ ]+" words "${inner}")
+    set(take 0)
+    set(give 0)
+    set(side take)
+    set(seen_dashes FALSE)
+    foreach(word IN LISTS words)
+      if(word STREQUAL "--")
+        if(seen_dashes)
+          return()
+        endif()
+        set(seen_dashes TRUE)
+        set(side give)
+      elseif(word MATCHES "\\.\\.\\.")
+        return()
+      else()
+        math(EXPR ${side} "${${side}} + 1")
+      endif()
+    endforeach()
+    if(NOT seen_dashes)
+      return()
+    endif()
+    set(${out}_${field}_take ${take} PARENT_SCOPE)
+    set(${out}_${field}_give ${give} PARENT_SCOPE)
+  endforeach()
+  if(fields STREQUAL "rs")
+    set(${out}_rs_take 0 PARENT_SCOPE)
+    set(${out}_rs_give 0 PARENT_SCOPE)
+  endif()
+  set(${out}_ok TRUE PARENT_SCOPE)
+endfunction()
+
+# Apply one effect to the running body effect (ds, ds_min, rs). A negative
+# RS depth would reach into the caller's cells: the body stays unchecked.
+macro(froth_apply_effect take give rs_take rs_give)
+  math(EXPR ds "${ds} - ${take}")
+  if(ds LESS ds_min)
+    set(ds_min ${ds})
+  endif()
+  math(EXPR ds "${ds} + ${give}")
+  math(EXPR rs "${rs} - ${rs_take}")
+  if(rs LESS 0)
+    set(exact FALSE)
+  endif()
+  math(EXPR rs "${rs} + ${rs_give}")
+endmacro()
+
+# --- Code generation ---------------------------------------------------------
+
+# Emit C for body tokens first..end-1 at the given loop nesting level.
+# Appends to `code` and `caches` and updates the running effect in the
+# caller's scope.
+function(froth_compile_range first end level)
+  string(REPEAT "  " ${level} indent)
+  string(APPEND indent "  ")
+  set(i ${first})
+  while(i LESS end)
+    list(GET tokens ${i} tok)
+
+    froth_match_perm("${tokens}" ${i} ${end} perm)
+    if(NOT perm_next EQUAL -1)
+      string(APPEND code "${indent}FROTH_TRY(froth_perm_apply(vm, ${perm_n}, "
+                         "(const uint8_t[]){${perm_bytes}}));\n")
+      froth_apply_effect(${perm_take} ${perm_give} 0 0)
+      set(i ${perm_next})
+      continue()
+    endif()
+    math(EXPR i "${i} + 1")
+
+    if(tok MATCHES "^(-?)(0x[0-9a-fA-F]+|[0-9]+)$")
+      if(CMAKE_MATCH_1)
+        set(literal "-${CMAKE_MATCH_2}")
+      else()
+        set(literal "${CMAKE_MATCH_2}")
+      endif()
+      string(APPEND code "${indent}FROTH_TRY(froth_push(vm, ${literal}));\n")
+      froth_apply_effect(0 1 0 0)
+    elseif(tok STREQUAL "<OPEN>")
+      # [ cond ] [ body ] while
+      froth_find_close("${tokens}" ${i} cond_end)
+      set(body_open ${cond_end})
+      set(while_ok FALSE)
+      if(cond_end GREATER 0 AND cond_end LESS end)
+        list(GET tokens ${body_open} next)
+        if(next STREQUAL "<OPEN>")
+          math(EXPR body_first "${body_open} + 1")
+          froth_find_close("${tokens}" ${body_first} body_end)
+          if(body_end GREATER 0 AND body_end LESS end)
+            list(GET tokens ${body_end} next)
+            if(next STREQUAL "while")
+              set(while_ok TRUE)
+            endif()
+          endif()
+        endif()
+      endif()
+      if(NOT while_ok)
+        message(FATAL_ERROR "${input_name}: cannot compile '${word}': "
+                            "quotations are only compiled in "
+                            "`[ cond ] [ body ] while`")
+      endif()
+
+      math(EXPR cond_last "${cond_end} - 1")
+      math(EXPR body_last "${body_end} - 1")
+      string(APPEND code
+        "${indent}{\n"
+        "${indent}  froth_cell_u_t depth${level} = vm->ds.pointer;\n"
+        "${indent}  for (;;) {\n"
+        "${indent}    bool flag${level};\n"
+        "${indent}    FROTH_TRY(froth_aot_safepoint(vm));\n")
+      math(EXPR inner_level "${level} + 2")
+      froth_compile_range(${i} ${cond_last} ${inner_level})
+      string(APPEND code
+        "${indent}    FROTH_TRY(froth_aot_while_test(vm, depth${level}, "
+        "&flag${level}));\n"
+        "${indent}    if (!flag${level})\n"
+        "${indent}      break;\n")
+      froth_compile_range(${body_first} ${body_last} ${inner_level})
+      string(APPEND code
+        "${indent}    FROTH_TRY(froth_aot_while_end(vm, depth${level}));\n"
+        "${indent}  }\n"
+        "${indent}}\n")
+      set(exact FALSE)
+      math(EXPR i "${body_end} + 1")
+    elseif(tok MATCHES "^<" OR tok MATCHES "^'" OR tok STREQUAL ":")
+      message(FATAL_ERROR "${input_name}: cannot compile '${word}': "
+                          "unsupported token in body")
+    else()
+      froth_compile_word("${tok}")
+    endif()
+  endwhile()
+
+  foreach(var code caches used_prims ds ds_min rs exact)
+    set(${var} "${${var}}" PARENT_SCOPE)
+  endforeach()
+endfunction()
+
+# Emit one word call, resolved as the header comment describes.
+macro(froth_compile_word name)
+  set(resolved FALSE)
+  set(shuffle_prefix "")
+  list(FIND input_def_names "${name}" defined_here)
+  if(NOT defined_here EQUAL -1)
+    list(FIND compiled_names "${name}" compiled_index)
+    if(NOT compiled_index EQUAL -1)
+      list(GET compiled_symbols ${compiled_index} symbol)
+      string(APPEND code "${indent}FROTH_TRY(${symbol}(vm));\n")
+      if(effect_${symbol}_ok)
+        froth_apply_effect(${effect_${symbol}_ds_take}
+                           ${effect_${symbol}_ds_give} 0 0)
+      else()
+        set(exact FALSE)
+      endif()
+      set(resolved TRUE)
+    elseif("${name}" IN_LIST input_shuffles)
+      set(shuffle_prefix input)
+    endif()
+  else()
+    foreach(ctx_prefix IN LISTS context_prefixes)
+      if("${name}" IN_LIST ${ctx_prefix}_shuffles)
+        set(shuffle_prefix ${ctx_prefix})
+      endif()
+    endforeach()
+    list(FIND prim_names "${name}" prim_index)
+    if(NOT shuffle_prefix AND NOT prim_index EQUAL -1)
+      list(GET prim_symbols ${prim_index} symbol)
+      list(APPEND used_prims ${symbol})
+      string(APPEND code "${indent}FROTH_TRY(${symbol}(vm));\n")
+      froth_parse_effect("${prim_effect_${symbol}}" prim)
+      if(prim_ok AND NOT "${name}" IN_LIST control_prims)
+        froth_apply_effect(${prim_ds_take} ${prim_ds_give} ${prim_rs_take}
+                           ${prim_rs_give})
+      else()
+        set(exact FALSE)
+      endif()
+      set(resolved TRUE)
+    endif()
+  endif()
+
+  if(shuffle_prefix)
+    set(sp shuffle_${shuffle_prefix}_${name})
+    string(APPEND code "${indent}FROTH_TRY(froth_perm_apply(vm, ${${sp}_n}, "
+                       "(const uint8_t[]){${${sp}_bytes}}));\n")
+    froth_apply_effect(${${sp}_n} ${${sp}_give} 0 0)
+    set(resolved TRUE)
+  endif()
+
+  if(NOT resolved)
+    list(FIND caches "${name}" cache_index)
+    if(cache_index EQUAL -1)
+      list(LENGTH caches cache_index)
+      list(APPEND caches "${name}")
+    endif()
+    string(REPLACE "\\" "\\\\" c_name "${name}")
+    string(APPEND code "${indent}FROTH_TRY(froth_aot_call(vm, \"${c_name}\", "
+                       "&slot_cache[${cache_index}]));\n")
+    set(exact FALSE)
+  endif()
+endmacro()
+
+# --- Main --------------------------------------------------------------------
+
+file(READ "${INPUT}" input_text)
+froth_tokenize("${input_name}" "${input_text}" input)
+froth_collect_defs("${input_name}" "${input_text}" input)
+froth_collect_shuffles(input)
+set(tokens "${input_tokens}")
+
+set(context_prefixes "")
+set(ctx_index 0)
+foreach(ctx_file IN LISTS context_files)
+  file(READ "${ctx_file}" ctx_text)
+  froth_tokenize("${ctx_file}" "${ctx_text}" ctx${ctx_index})
+  froth_collect_defs("${ctx_file}" "${ctx_text}" ctx${ctx_index})
+  froth_collect_shuffles(ctx${ctx_index})
+  list(APPEND context_prefixes ctx${ctx_index})
+  math(EXPR ctx_index "${ctx_index} + 1")
+endforeach()
+
+# Kernel primitives: {"name", froth_prim_x, "effect", ...} entries.
+file(READ "${PRIMITIVES}" prims_text)
+string(REGEX MATCHALL
+       "{\"[^\"]+\",[ \t\r\n]*froth_prim_[a-z0-9_]+,[ \t\r\n]*\"[^\"]*\""
+       prim_entries "${prims_text}")
+set(prim_names "")
+set(prim_symbols "")
+foreach(entry IN LISTS prim_entries)
+  string(REGEX MATCH
+         "^{\"([^\"]+)\",[ \t\r\n]*(froth_prim_[a-z0-9_]+),[ \t\r\n]*\"([^\"]*)\""
+         _ "${entry}")
+  list(APPEND prim_names "${CMAKE_MATCH_1}")
+  list(APPEND prim_symbols "${CMAKE_MATCH_2}")
+  set(prim_effect_${CMAKE_MATCH_2} "${CMAKE_MATCH_3}")
+endforeach()
+
+set(compiled_names "")
+set(compiled_symbols "")
+set(exact_symbols "")
+set(used_prims "")
+set(caches "")
+set(functions "")
+set(entries "")
+set(residual "")
+set(residual_from 0)
+
+set(k 0)
+foreach(word IN LISTS input_def_names)
+  math(EXPR next_k "${k} + 1")
+  if(NOT "${word}" IN_LIST aot_words)
+    set(k ${next_k})
+    continue()
+  endif()
+  set(def_count 0)
+  foreach(name IN LISTS input_def_names)
+    if(name STREQUAL word)
+      math(EXPR def_count "${def_count} + 1")
+    endif()
+  endforeach()
+  if(def_count GREATER 1)
+    message(FATAL_ERROR "${input_name}: cannot compile '${word}': "
+                        "it is defined more than once")
+  endif()
+
+  string(MAKE_C_IDENTIFIER "${word}" ident)
+  set(symbol "aot_${ident}")
+  if(symbol IN_LIST compiled_symbols)
+    set(symbol "aot_${ident}_${k}")
+  endif()
+
+  set(ds 0)
+  set(ds_min 0)
+  set(rs 0)
+  set(exact TRUE)
+  set(code "")
+  froth_compile_range(${input_def_${k}_first} ${input_def_${k}_last} 0)
+
+  # The declared effect is trusted only if the body has the same one.
+  set(decl "${input_def_${k}_effect}")
+  froth_parse_effect("${decl}" declared)
+  math(EXPR ds_in "0 - ${ds_min}")
+  math(EXPR ds_out "${ds_in} + ${ds}")
+  set(effect_${symbol}_ok FALSE)
+  if(exact AND rs EQUAL 0 AND declared_ok)
+    if(declared_ds_take EQUAL ds_in AND declared_ds_give EQUAL ds_out AND
+       declared_rs_take EQUAL 0 AND declared_rs_give EQUAL 0)
+      set(effect_${symbol}_ok TRUE)
+      set(effect_${symbol}_ds_take ${ds_in})
+      set(effect_${symbol}_ds_give ${ds_out})
+      list(APPEND exact_symbols ${symbol})
+    else()
+      message(WARNING "${input_name}: '${word}' is declared ${decl} but its "
+                      "body is ( ${ds_in} -- ${ds_out} )")
+    endif()
+  endif()
+
+  string(REPLACE "\\" "\\\\" c_word "${word}")
+  string(REPLACE "\\" "\\\\" c_decl "${decl}")
+  string(REPLACE "\"" "\\\"" c_decl "${c_decl}")
+  string(REPLACE "*/" "* /" comment_decl "${decl}")
+  string(APPEND functions
+    "\n/* : ${word} ${comment_decl} */\n"
+    "static froth_error_t ${symbol}(froth_vm_t *vm) {\n"
+    "${code}"
+    "  return FROTH_OK;\n"
+    "}\n")
+  string(APPEND entries
+    "    {\"${c_word}\", ${symbol}, \"${c_decl}\", "
+    "\"Compiled from ${input_name}\"},\n")
+  list(APPEND compiled_names "${word}")
+  list(APPEND compiled_symbols ${symbol})
+
+  # Drop the definition from the embedded text.
+  math(EXPR keep "${input_def_${k}_start} - ${residual_from}")
+  string(SUBSTRING "${input_text}" ${residual_from} ${keep} piece)
+  string(APPEND residual "${piece}")
+  set(residual_from ${input_def_${k}_end})
+  set(k ${next_k})
+endforeach()
+string(SUBSTRING "${input_text}" ${residual_from} -1 piece)
+string(APPEND residual "${piece}")
+
+# --- Output ------------------------------------------------------------------
+
+set(c_text "/* Generated by cmake/compile_froth.cmake from ${input_name}. */\n\n#include \"froth_aot.h\"\n")
+list(REMOVE_DUPLICATES used_prims)
+if(used_prims)
+  string(APPEND c_text "\n")
+endif()
+foreach(symbol IN LISTS used_prims)
+  string(APPEND c_text "froth_error_t ${symbol}(froth_vm_t *froth_vm);\n")
+endforeach()
+list(LENGTH caches cache_count)
+if(cache_count GREATER 0)
+  set(unresolved "${caches}")
+  list(TRANSFORM unresolved REPLACE "^.+$" "FROTH_AOT_UNRESOLVED")
+  string(JOIN ",\n    " initializer ${unresolved})
+  string(APPEND c_text "\n/* Slots of the words called by name. */\n"
+                       "static froth_cell_u_t slot_cache[${cache_count}] = {\n"
+                       "    ${initializer}};\n")
+endif()
+string(APPEND c_text "${functions}\n"
+                     "const froth_ffi_entry_t ${VARNAME}_aot[] = {\n"
+                     "${entries}"
+                     "    {0}};\n\n"
+                     "const froth_native_word_t ${VARNAME}_aot_exact[] = {\n")
+foreach(symbol IN LISTS exact_symbols)
+  string(APPEND c_text "    ${symbol},\n")
+endforeach()
+string(APPEND c_text "    NULL};\n")
+file(WRITE "${SOURCE}" "${c_text}")
+
+string(HEX "${residual}" hex)
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1, " c_bytes "${hex}")
+file(WRITE "${OUTPUT}"
+  "#include \"froth_aot.h\"\n"
+  "extern const froth_ffi_entry_t ${VARNAME}_aot[];\n"
+  "extern const froth_native_word_t ${VARNAME}_aot_exact[];\n"
+  "#ifndef FROTH_BOOT_IMAGE\n"
+  "static const char ${VARNAME}[] = {${c_bytes}0x00};\n"
+  "#endif\n")
@@ -22,6 +22,10 @@ uint32_t platform_uptime_ms(void) {
   return (uint32_t)(esp_timer_get_time() / 1000);
 }
 
+#ifdef FROTH_PROFILE
+uint32_t platform_uptime_us(void) { return (uint32_t)esp_timer_get_time(); }
+#endif
+
 froth_error_t platform_init(void) {
   // Disable stdio buffering before installing driver.
   setvbuf(stdin, NULL, _IONBF, 0);
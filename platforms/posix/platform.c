@@ -33,6 +33,14 @@ uint32_t platform_uptime_ms(void) {
   return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
 }
 
+#ifdef FROTH_PROFILE
+uint32_t platform_uptime_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+#endif
+
 static void cleanup_term(void) {
   if (!term_configured)
     return;
@@ -0,0 +1,111 @@
+#include "froth_aot.h"
+#include "froth_console.h"
+#include "froth_executor.h"
+#include "froth_profile.h"
+#include "froth_slot_table.h"
+#include <string.h>
+
+typedef struct {
+  const froth_ffi_entry_t *table;
+  const froth_native_word_t *exact;
+} aot_table_t;
+
+static aot_table_t aot_tables[FROTH_AOT_MAX_TABLES];
+static froth_cell_u_t aot_table_count = 0;
+
+froth_error_t froth_aot_register(froth_vm_t *vm, const froth_ffi_entry_t *table,
+                                 const froth_native_word_t *exact) {
+  if (aot_table_count >= FROTH_AOT_MAX_TABLES) {
+    return FROTH_ERROR_FFI_TABLE_FULL;
+  }
+  FROTH_TRY(froth_ffi_register(vm, table));
+  aot_tables[aot_table_count++] = (aot_table_t){table, exact};
+  return FROTH_OK;
+}
+
+froth_error_t froth_aot_bind(froth_vm_t *vm, const froth_ffi_entry_t *table,
+                             const froth_native_word_t *exact) {
+  if (aot_table_count >= FROTH_AOT_MAX_TABLES) {
+    return FROTH_ERROR_FFI_TABLE_FULL;
+  }
+  FROTH_TRY(froth_ffi_bind(vm, table));
+  aot_tables[aot_table_count++] = (aot_table_t){table, exact};
+  return FROTH_OK;
+}
+
+bool froth_aot_is_compiled(froth_native_word_t prim) {
+  for (froth_cell_u_t t = 0; t < aot_table_count; t++) {
+    for (const froth_ffi_entry_t *e = aot_tables[t].table; e->name != NULL;
+         e++) {
+      if (e->word == prim)
+        return true;
+    }
+  }
+  return false;
+}
+
+bool froth_aot_is_exact(froth_native_word_t prim) {
+  for (froth_cell_u_t t = 0; t < aot_table_count; t++) {
+    for (const froth_native_word_t *w = aot_tables[t].exact; *w != NULL; w++) {
+      if (*w == prim)
+        return true;
+    }
+  }
+  return false;
+}
+
+froth_error_t froth_aot_call(froth_vm_t *vm, const char *name,
+                             froth_cell_u_t *cache) {
+  const char *cached_name;
+  if (*cache >= froth_slot_count() ||
+      froth_slot_get_name(*cache, &cached_name) != FROTH_OK ||
+      strcmp(cached_name, name) != 0) {
+    *cache = FROTH_AOT_UNRESOLVED;
+    FROTH_TRY(froth_slot_find_name(name, cache));
+  }
+
+  /* A quotation re-enters the trampoline, which counts itself. A native
+   * word may be another compiled word calling back here, so count it too. */
+  if (froth_slot_entry(*cache)->prim == NULL)
+    return froth_execute_slot(vm, *cache);
+  if (vm->trampoline_depth >= FROTH_REENTRY_DEPTH_MAX)
+    return FROTH_ERROR_CALL_DEPTH;
+  vm->trampoline_depth++;
+  froth_error_t err = froth_execute_slot(vm, *cache);
+  vm->trampoline_depth--;
+  return err;
+}
+
+froth_error_t froth_aot_safepoint(froth_vm_t *vm) {
+  if (vm->safepoint_budget != 0) {
+    vm->safepoint_budget--;
+    return FROTH_OK;
+  }
+  vm->safepoint_budget = FROTH_SAFEPOINT_INTERVAL - 1;
+  froth_profile_sample();
+  froth_console_poll(vm);
+  if (vm->interrupted == 0)
+    return FROTH_OK;
+  vm->interrupted = 0;
+  return froth_throw(vm, FROTH_ERROR_PROGRAM_INTERRUPTED);
+}
+
+froth_error_t froth_aot_while_test(froth_vm_t *vm, froth_cell_u_t depth,
+                                   bool *flag) {
+  if (vm->ds.pointer != depth + 1) {
+    return FROTH_ERROR_WHILE_STACK;
+  }
+  froth_cell_t cell = vm->ds.data[--vm->ds.pointer];
+  if (!FROTH_CELL_IS_NUMBER(cell)) {
+    return FROTH_ERROR_TYPE_MISMATCH;
+  }
+  *flag = FROTH_CELL_STRIP_TAG(cell) != 0;
+  return FROTH_OK;
+}
+
+froth_error_t froth_aot_while_end(froth_vm_t *vm, froth_cell_u_t depth) {
+  if (vm->ds.pointer != depth) {
+    return FROTH_ERROR_WHILE_STACK;
+  }
+  return FROTH_OK;
+}
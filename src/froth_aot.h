@@ -0,0 +1,60 @@
+#pragma once
+
+#include "froth_ffi.h"
+#include "froth_primitives.h"
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Build-time compiled definitions (ADR-056).
+ *
+ * cmake/compile_froth.cmake translates the FROTH_AOT_WORDS definitions of
+ * an embedded .froth file into C functions. Each file gets one generated
+ * froth_ffi_entry_t table, registered at boot before the rest of the file
+ * is evaluated. The generated code calls kernel primitives and earlier
+ * compiled words of the same file directly, inlines `n pat perm` shuffles,
+ * and looks up every other word by name when it runs.
+ *
+ * Compiled words are primitives, but def may rebind them like the
+ * quotation words they replace. */
+
+#ifndef FROTH_AOT_MAX_TABLES
+#define FROTH_AOT_MAX_TABLES 4
+#endif
+
+/* Slot cache value for a name that has not been looked up yet. */
+#define FROTH_AOT_UNRESOLVED ((froth_cell_u_t)-1)
+
+/* Register a generated table. exact is a NULL-terminated list of the
+ * entries whose declared stack effect the compiler checked against their
+ * body; the verifier (ADR-055) trusts only those. */
+froth_error_t froth_aot_register(froth_vm_t *vm, const froth_ffi_entry_t *table,
+                                 const froth_native_word_t *exact);
+
+/* The same, for a table whose slots a boot image holds (ADR-071). */
+froth_error_t froth_aot_bind(froth_vm_t *vm, const froth_ffi_entry_t *table,
+                             const froth_native_word_t *exact);
+
+/* True if prim came from a generated table. */
+bool froth_aot_is_compiled(froth_native_word_t prim);
+
+/* True if prim's declared stack effect was checked at build time. */
+bool froth_aot_is_exact(froth_native_word_t prim);
+
+/* --- Runtime support for generated code --- */
+
+/* Call the word currently bound to name. *cache remembers its slot between
+ * calls and is revalidated against the name each time. */
+froth_error_t froth_aot_call(froth_vm_t *vm, const char *name,
+                             froth_cell_u_t *cache);
+
+/* A safe point for compiled loops: shares the executor's poll budget
+ * (ADR-052) and throws on interrupt. */
+froth_error_t froth_aot_safepoint(froth_vm_t *vm);
+
+/* The checks the executor makes when a while condition and body return
+ * (ADR-053). depth is the DS depth when the loop started. */
+froth_error_t froth_aot_while_test(froth_vm_t *vm, froth_cell_u_t depth,
+                                   bool *flag);
+froth_error_t froth_aot_while_end(froth_vm_t *vm, froth_cell_u_t depth);
@@ -0,0 +1,211 @@
+#ifdef FROTH_ARRAYS
+
+#include "froth_executor.h"
+#include "froth_gc.h"
+#include "froth_object.h"
+#include "froth_stack.h"
+#include "froth_tbuf.h"
+#include <string.h>
+
+/* Cell arrays (ADR-064). An array's body is its elements, so its length is
+ * the object's cell count. Elements are any Froth value. */
+
+/* Pop an array and an index into it: ( arr i -- ). */
+static froth_error_t pop_element(froth_vm_t *vm, froth_cell_u_t *offset,
+                                 froth_cell_u_t *index) {
+  froth_cell_t i;
+  FROTH_TRY(froth_pop(vm, &i));
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_ARRAY, offset));
+  if (i < 0 || (froth_cell_u_t)i >= froth_object_count(&vm->heap, *offset))
+    return FROTH_ERROR_BOUNDS;
+  *index = (froth_cell_u_t)i;
+  return FROTH_OK;
+}
+
+/* ---- arr.new ---- ( n -- arr ) */
+static froth_error_t prim_new(froth_vm_t *vm) {
+  froth_cell_t n;
+  froth_cell_u_t offset;
+
+  FROTH_TRY(froth_pop(vm, &n));
+  if (n < 0)
+    return FROTH_ERROR_BOUNDS;
+  FROTH_TRY(froth_object_allocate(&vm->heap, FROTH_OBJECT_ARRAY,
+                                  (froth_cell_u_t)n, &offset));
+  return froth_stack_push(&vm->ds, froth_object_cell(offset));
+}
+
+/* ---- arr.len ---- ( arr -- n ) */
+static froth_error_t prim_len(froth_vm_t *vm) {
+  froth_cell_u_t offset;
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_ARRAY, &offset));
+  return froth_push(vm, (froth_cell_t)froth_object_count(&vm->heap, offset));
+}
+
+/* ---- arr@ ---- ( arr i -- x ) */
+static froth_error_t prim_fetch(froth_vm_t *vm) {
+  froth_cell_u_t offset, index;
+
+  FROTH_TRY(pop_element(vm, &offset, &index));
+  return froth_stack_push(&vm->ds,
+                          froth_object_cells(&vm->heap, offset)[index]);
+}
+
+/* ---- arr! ---- ( x arr i -- )
+ * A transient string is promoted, as def does: the array outlives the
+ * ring. */
+static froth_error_t prim_store(froth_vm_t *vm) {
+  froth_cell_t x;
+  froth_cell_u_t offset, index;
+
+  FROTH_TRY(pop_element(vm, &offset, &index));
+  FROTH_TRY(froth_stack_pop(&vm->ds, &x));
+  if (FROTH_CELL_IS_BSTRING(x) &&
+      FROTH_BSTRING_IS_TRANSIENT(FROTH_CELL_STRIP_TAG(x)))
+    FROTH_TRY(froth_bstring_promote(vm, x, &x));
+  froth_object_cells(&vm->heap, offset)[index] = x;
+  return FROTH_OK;
+}
+
+/* ---- arr.fill ---- ( arr x -- )
+ * One store, then the filled prefix is copied onto the rest, doubling each
+ * time. Zero is a plain memset. */
+static froth_error_t prim_fill(froth_vm_t *vm) {
+  froth_cell_t x;
+  froth_cell_u_t offset;
+
+  FROTH_TRY(froth_stack_pop(&vm->ds, &x));
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_ARRAY, &offset));
+  if (FROTH_CELL_IS_BSTRING(x) &&
+      FROTH_BSTRING_IS_TRANSIENT(FROTH_CELL_STRIP_TAG(x)))
+    FROTH_TRY(froth_bstring_promote(vm, x, &x));
+
+  froth_cell_t *cells = froth_object_cells(&vm->heap, offset);
+  froth_cell_u_t count = froth_object_count(&vm->heap, offset);
+  if (count == 0)
+    return FROTH_OK;
+  if (x == 0) {
+    memset(cells, 0, count * sizeof(froth_cell_t));
+    return FROTH_OK;
+  }
+  cells[0] = x;
+  for (froth_cell_u_t done = 1; done < count; done *= 2) {
+    froth_cell_u_t n = done < count - done ? done : count - done;
+    memcpy(&cells[done], cells, n * sizeof(froth_cell_t));
+  }
+  return FROTH_OK;
+}
+
+/* ---- arr.copy ---- ( src si dst di n -- )
+ * Overlapping ranges of one array copy as if through a temporary. */
+static froth_error_t prim_copy(froth_vm_t *vm) {
+  froth_cell_t n, di, si;
+  froth_cell_u_t src, dst;
+
+  FROTH_TRY(froth_pop(vm, &n));
+  FROTH_TRY(froth_pop(vm, &di));
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_ARRAY, &dst));
+  FROTH_TRY(froth_pop(vm, &si));
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_ARRAY, &src));
+
+  froth_cell_u_t src_count = froth_object_count(&vm->heap, src);
+  froth_cell_u_t dst_count = froth_object_count(&vm->heap, dst);
+  if (n < 0 || si < 0 || di < 0 || (froth_cell_u_t)si > src_count ||
+      (froth_cell_u_t)n > src_count - (froth_cell_u_t)si ||
+      (froth_cell_u_t)di > dst_count ||
+      (froth_cell_u_t)n > dst_count - (froth_cell_u_t)di)
+    return FROTH_ERROR_BOUNDS;
+
+  memmove(&froth_object_cells(&vm->heap, dst)[di],
+          &froth_object_cells(&vm->heap, src)[si],
+          (froth_cell_u_t)n * sizeof(froth_cell_t));
+  return FROTH_OK;
+}
+
+/* ---- arr.each ---- ( arr q -- )
+ * Calls q ( x -- ) with each element in turn. q may store into the array;
+ * the length is read again before every call. */
+static froth_error_t prim_each(froth_vm_t *vm) {
+  froth_cell_t q;
+  froth_cell_u_t offset;
+  froth_error_t err = FROTH_OK;
+
+  FROTH_TRY(froth_stack_pop(&vm->ds, &q));
+  if (!FROTH_CELL_IS_QUOTE(q))
+    return FROTH_ERROR_TYPE_MISMATCH;
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_ARRAY, &offset));
+
+  froth_gc_hold(vm);
+  for (froth_cell_u_t i = 0; i < froth_object_count(&vm->heap, offset); i++) {
+    err = froth_stack_push(&vm->ds, froth_object_cells(&vm->heap, offset)[i]);
+    if (err == FROTH_OK)
+      err = froth_execute_quote(vm, q);
+    if (err != FROTH_OK)
+      break;
+  }
+  froth_gc_release(vm);
+  return err;
+}
+
+/* ---- arr.grow ---- ( arr n -- arr' )
+ * An array of length n holding arr's elements, then zeros. The last object
+ * on the heap grows in place unless an arena opened after it would drop
+ * the new cells; any other array is copied. Use the result, not arr. */
+static froth_error_t prim_grow(froth_vm_t *vm) {
+  froth_cell_t n;
+  froth_cell_u_t offset, grown;
+
+  FROTH_TRY(froth_pop(vm, &n));
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_ARRAY, &offset));
+
+  froth_cell_u_t count = froth_object_count(&vm->heap, offset);
+  if (n < 0 || (froth_cell_u_t)n < count)
+    return FROTH_ERROR_BOUNDS;
+
+  froth_cell_u_t end = offset + (1 + count) * sizeof(froth_cell_t);
+  bool in_arena =
+      vm->arenas.pointer > 0 &&
+      offset < (froth_cell_u_t)vm->arenas.data[vm->arenas.pointer - 1];
+  if (end == vm->heap.pointer && !in_arena) {
+    froth_cell_u_t extra;
+    FROTH_TRY(froth_heap_allocate_bytes(((froth_cell_u_t)n - count) *
+                                            sizeof(froth_cell_t),
+                                        &vm->heap, &extra));
+    memset(&vm->heap.data[extra], 0, vm->heap.pointer - extra);
+    froth_heap_cell_ptr(&vm->heap, offset)[0] =
+        (froth_cell_t)(((froth_cell_u_t)n << 3) | FROTH_OBJECT_ARRAY);
+    return froth_stack_push(&vm->ds, froth_object_cell(offset));
+  }
+
+  FROTH_TRY(froth_object_allocate(&vm->heap, FROTH_OBJECT_ARRAY,
+                                  (froth_cell_u_t)n, &grown));
+  memcpy(froth_object_cells(&vm->heap, grown),
+         froth_object_cells(&vm->heap, offset), count * sizeof(froth_cell_t));
+  return froth_stack_push(&vm->ds, froth_object_cell(grown));
+}
+
+FROTH_FFI(prim_new, "arr.new", "( n -- arr )", "New array of n zeros");
+FROTH_FFI(prim_len, "arr.len", "( arr -- n )", "Number of elements");
+FROTH_FFI(prim_fetch, "arr@", "( arr i -- x )", "Fetch element i");
+FROTH_FFI(prim_store, "arr!", "( x arr i -- )", "Store x as element i");
+FROTH_FFI(prim_fill, "arr.fill", "( arr x -- )", "Store x in every element");
+FROTH_FFI(prim_copy, "arr.copy", "( src si dst di n -- )",
+          "Copy n elements from src at si to dst at di");
+FROTH_FFI(prim_each, "arr.each", "( arr q -- )",
+          "Call q ( x -- ) with each element");
+FROTH_FFI(prim_grow, "arr.grow", "( arr n -- arr' )",
+          "Array of length n with arr's elements, then zeros");
+
+const froth_ffi_entry_t froth_array_prims[] = {
+    FROTH_BIND(prim_new),
+    FROTH_BIND(prim_len),
+    FROTH_BIND(prim_fetch),
+    FROTH_BIND(prim_store),
+    FROTH_BIND(prim_fill),
+    FROTH_BIND(prim_copy),
+    FROTH_BIND(prim_each),
+    FROTH_BIND(prim_grow),
+    {0},
+};
+
+#endif /* FROTH_ARRAYS */
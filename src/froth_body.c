@@ -0,0 +1,127 @@
+#include "froth_body.h"
+
+/* Smallest width whose sign-extended bytes give back payload. */
+static froth_cell_u_t payload_width(froth_cell_t payload) {
+  froth_cell_u_t width = 1;
+  while (width < sizeof(froth_cell_t)) {
+    froth_cell_t limit = (froth_cell_t)1 << (8 * width - 1);
+    if (payload >= -limit && payload < limit)
+      break;
+    width++;
+  }
+  return width;
+}
+
+static bool short_call(froth_cell_t cell) {
+  froth_cell_t payload = FROTH_CELL_STRIP_TAG(cell);
+  return FROTH_CELL_IS_CALL(cell) && payload >= 0 &&
+         payload < FROTH_BODY_OP_NUMBER;
+}
+
+static bool short_number(froth_cell_t cell) {
+  froth_cell_t payload = FROTH_CELL_STRIP_TAG(cell);
+  return FROTH_CELL_IS_NUMBER(cell) &&
+         payload >= FROTH_BODY_OP_NUMBER - FROTH_BODY_NUMBER_ZERO &&
+         payload < FROTH_BODY_OP_ESCAPE - FROTH_BODY_NUMBER_ZERO;
+}
+
+froth_cell_u_t froth_body_encoded_size(froth_cell_t cell) {
+  if (short_call(cell) || short_number(cell))
+    return 1;
+  return 1 + payload_width(FROTH_CELL_STRIP_TAG(cell));
+}
+
+froth_cell_u_t froth_body_encode(froth_cell_t cell, uint8_t *out) {
+  froth_cell_t payload = FROTH_CELL_STRIP_TAG(cell);
+  if (short_call(cell)) {
+    out[0] = (uint8_t)payload;
+    return 1;
+  }
+  if (short_number(cell)) {
+    out[0] = (uint8_t)(payload + FROTH_BODY_NUMBER_ZERO);
+    return 1;
+  }
+
+  froth_cell_u_t width = payload_width(payload);
+  out[0] = (uint8_t)(FROTH_BODY_OP_ESCAPE | (FROTH_CELL_GET_TAG(cell) << 3) |
+                     (width - 1));
+  for (froth_cell_u_t i = 0; i < width; i++)
+    out[1 + i] = (uint8_t)((froth_cell_u_t)payload >> (8 * i));
+  return 1 + width;
+}
+
+froth_cell_u_t froth_body_count(const froth_heap_t *heap,
+                                froth_cell_u_t offset) {
+#ifdef FROTH_COMPACT_QUOTES
+  froth_cell_u_t length = froth_body_length(heap, offset);
+  froth_cell_u_t count = 0;
+  for (froth_cell_u_t ip = 1; ip <= length; count++)
+    froth_body_next(heap, offset, &ip);
+  return count;
+#else
+  return froth_body_length(heap, offset);
+#endif
+}
+
+bool froth_body_at(const froth_heap_t *heap, froth_cell_u_t offset,
+                   froth_cell_u_t index, froth_cell_t *cell) {
+  froth_cell_u_t length = froth_body_length(heap, offset);
+#ifdef FROTH_COMPACT_QUOTES
+  /* No fixed stride: walk to the token. */
+  froth_cell_u_t ip = 1;
+  for (froth_cell_u_t i = 0; ip <= length; i++) {
+    froth_cell_t token = froth_body_next(heap, offset, &ip);
+    if (i == index) {
+      *cell = token;
+      return true;
+    }
+  }
+  return false;
+#else
+  if (index >= length)
+    return false;
+  *cell = ((const froth_cell_t *)&heap->data[offset])[1 + index];
+  return true;
+#endif
+}
+
+froth_error_t froth_body_allocate(froth_heap_t *heap, froth_cell_u_t length,
+                                  froth_cell_u_t *offset) {
+  froth_cell_t *header;
+#ifdef FROTH_COMPACT_QUOTES
+  froth_cell_u_t mark = heap->pointer;
+  froth_cell_u_t code;
+  FROTH_TRY(froth_heap_allocate_cells(1, heap, &header, offset));
+  if (froth_heap_allocate_bytes(length, heap, &code) != FROTH_OK) {
+    heap->pointer = mark;
+    return FROTH_ERROR_HEAP_OUT_OF_MEMORY;
+  }
+#else
+  FROTH_TRY(froth_heap_allocate_cells(1 + length, heap, &header, offset));
+#endif
+  header[0] = (froth_cell_t)length;
+  return FROTH_OK;
+}
+
+void froth_body_put(froth_heap_t *heap, froth_cell_u_t offset,
+                    froth_cell_u_t *ip, froth_cell_t cell) {
+#ifdef FROTH_COMPACT_QUOTES
+  uint8_t *code = (uint8_t *)froth_body_code(heap, offset);
+  *ip += froth_body_encode(cell, &code[*ip]);
+#else
+  froth_heap_cell_ptr(heap, offset)[(*ip)++] = cell;
+#endif
+}
+
+void froth_body_store(froth_heap_t *heap, froth_cell_u_t offset,
+                      froth_cell_u_t ip, froth_cell_t cell) {
+#ifdef FROTH_COMPACT_QUOTES
+  uint8_t *code = (uint8_t *)froth_body_code(heap, offset);
+  froth_cell_u_t width = froth_body_payload_width(code[ip]);
+  froth_cell_u_t payload = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell);
+  for (froth_cell_u_t i = 0; i < width; i++)
+    code[ip + 1 + i] = (uint8_t)(payload >> (8 * i));
+#else
+  froth_heap_cell_ptr(heap, offset)[ip] = cell;
+#endif
+}
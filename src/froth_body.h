@@ -0,0 +1,116 @@
+#pragma once
+
+#include "froth_heap.h"
+#include "froth_types.h"
+#include <stdbool.h>
+
+/* Quotation bodies (ADR-062).
+ *
+ * A quotation is a length cell followed by its body. By default the body
+ * holds one cell per token and the length counts cells. With
+ * FROTH_COMPACT_QUOTES the body is a byte code and the length counts bytes:
+ *
+ *   0x00-0x7F  call slot 0..127
+ *   0x80-0xBF  number -16..47
+ *   0xC0-0xFF  any other token: tag in bits 3-5, payload width minus one in
+ *              bits 0-2, then the payload, little-endian, sign-extended
+ *
+ * Either way a frame's ip runs from 1 to the length, so frames, tail calls
+ * and the collector's roots are the same in both. Snapshots always store
+ * tokens in the byte code, with object and name ids as payloads. */
+
+/* Longest encoded token. */
+#define FROTH_BODY_TOKEN_MAX (1 + sizeof(froth_cell_t))
+
+#define FROTH_BODY_OP_NUMBER 0x80
+#define FROTH_BODY_OP_ESCAPE 0xC0
+#define FROTH_BODY_NUMBER_ZERO 0x90
+
+/* Bytes froth_body_encode writes for cell. */
+froth_cell_u_t froth_body_encoded_size(froth_cell_t cell);
+
+/* Encode cell at out and return the bytes written. */
+froth_cell_u_t froth_body_encode(froth_cell_t cell, uint8_t *out);
+
+/* Payload bytes that follow the opcode op. */
+static inline froth_cell_u_t froth_body_payload_width(uint8_t op) {
+  return op < FROTH_BODY_OP_ESCAPE ? 0 : (froth_cell_u_t)(op & 7) + 1;
+}
+
+/* Decode the token at code[*pos] and move *pos past it. */
+static inline froth_cell_t froth_body_decode(const uint8_t *code,
+                                             froth_cell_u_t *pos) {
+  uint8_t op = code[(*pos)++];
+  if (op < FROTH_BODY_OP_NUMBER)
+    return FROTH_CELL_PACK_TAG((froth_cell_t)op, FROTH_CALL);
+  if (op < FROTH_BODY_OP_ESCAPE)
+    return FROTH_CELL_PACK_TAG((froth_cell_t)op - FROTH_BODY_NUMBER_ZERO,
+                               FROTH_NUMBER);
+
+  froth_cell_u_t width = froth_body_payload_width(op);
+  froth_cell_u_t payload = 0;
+  for (froth_cell_u_t i = 0; i < width; i++)
+    payload |= (froth_cell_u_t)code[*pos + i] << (8 * i);
+  *pos += width;
+  if (width < sizeof(froth_cell_t) && (payload >> (8 * width - 1)) & 1)
+    payload |= (froth_cell_u_t) ~(((froth_cell_u_t)1 << (8 * width)) - 1);
+  return (froth_cell_t)((payload << 3) | ((op >> 3) & 7));
+}
+
+#ifdef FROTH_COMPACT_QUOTES
+/* code[ip] is the byte at ip, counting from 1. */
+static inline const uint8_t *froth_body_code(const froth_heap_t *heap,
+                                             froth_cell_u_t offset) {
+  return &heap->data[offset + sizeof(froth_cell_t) - 1];
+}
+#endif
+
+/* Last ip of the body at offset. */
+static inline froth_cell_u_t froth_body_length(const froth_heap_t *heap,
+                                               froth_cell_u_t offset) {
+  return (froth_cell_u_t)((const froth_cell_t *)&heap->data[offset])[0];
+}
+
+/* The token at *ip, moving *ip to the next one. */
+static inline froth_cell_t froth_body_next(const froth_heap_t *heap,
+                                           froth_cell_u_t offset,
+                                           froth_cell_u_t *ip) {
+#ifdef FROTH_COMPACT_QUOTES
+  return froth_body_decode(froth_body_code(heap, offset), ip);
+#else
+  return ((const froth_cell_t *)&heap->data[offset])[(*ip)++];
+#endif
+}
+
+/* Length a token adds to a body. */
+static inline froth_cell_u_t froth_body_token_length(froth_cell_t cell) {
+#ifdef FROTH_COMPACT_QUOTES
+  return froth_body_encoded_size(cell);
+#else
+  (void)cell;
+  return 1;
+#endif
+}
+
+/* Tokens in the body at offset. */
+froth_cell_u_t froth_body_count(const froth_heap_t *heap,
+                                froth_cell_u_t offset);
+
+/* The token at index, counting from 0. False past the end. */
+bool froth_body_at(const froth_heap_t *heap, froth_cell_u_t offset,
+                   froth_cell_u_t index, froth_cell_t *cell);
+
+/* Allocate a quotation whose body is length long, as summed by
+ * froth_body_token_length, and write its length cell. */
+froth_error_t froth_body_allocate(froth_heap_t *heap, froth_cell_u_t length,
+                                  froth_cell_u_t *offset);
+
+/* Write cell as the token at *ip and move *ip past it. */
+void froth_body_put(froth_heap_t *heap, froth_cell_u_t offset,
+                    froth_cell_u_t *ip, froth_cell_t cell);
+
+/* Replace the reference at ip with cell, which has the same tag. Compact
+ * tokens keep their width, so the payload must fit it: the collector only
+ * moves references down. */
+void froth_body_store(froth_heap_t *heap, froth_cell_u_t offset,
+                      froth_cell_u_t ip, froth_cell_t cell);
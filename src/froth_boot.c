@@ -1,9 +1,16 @@
 #include "froth_boot.h"
+#include "froth_aot.h"
 #include "froth_evaluator.h"
 #include "froth_fmt.h"
+#include "froth_gc.h"
+#include "froth_image.h"
 #include "froth_lib_core.h"
+#include "froth_mem.h"
+#include "froth_object.h"
 #include "froth_primitives.h"
+#include "froth_profile.h"
 #include "froth_repl.h"
+#include "froth_slot_table.h"
 #include "froth_tbuf.h"
 #include "froth_vm.h"
 #include "platform.h"
@@ -49,39 +56,129 @@ static bool poll_for_safe_boot() {
   return safe_boot;
 }
 
-void froth_boot(const froth_ffi_entry_t *board_bindings) {
+/* Bind a primitive table. A boot image already holds its slots. */
+static froth_error_t register_table(const froth_ffi_entry_t *table) {
+#ifdef FROTH_BOOT_IMAGE
+  return froth_ffi_bind(&froth_vm, table);
+#else
+  return froth_ffi_register(&froth_vm, table);
+#endif
+}
+
+static froth_error_t register_compiled(const froth_ffi_entry_t *table,
+                                       const froth_native_word_t *exact) {
+#ifdef FROTH_BOOT_IMAGE
+  return froth_aot_bind(&froth_vm, table, exact);
+#else
+  return froth_aot_register(&froth_vm, table, exact);
+#endif
+}
+
+void froth_boot_base(const froth_ffi_entry_t *board_bindings) {
   froth_error_t err;
-  bool safe_boot = false; // Whether we skip restore & autorun
 
-  err = froth_ffi_register(&froth_vm, froth_primitives);
+  froth_mem_init(&froth_vm);
+
+#ifdef FROTH_BOOT_IMAGE
+  /* The libraries below were evaluated at build time (ADR-071). */
+  err = froth_image_load(&froth_vm);
+  if (err)
+    boot_fail("load boot image", err);
+#endif
+
+  err = register_table(froth_primitives);
   if (err)
     boot_fail("register primitives", err);
 
-  err = froth_ffi_register(&froth_vm, board_bindings);
+  err = register_table(board_bindings);
   if (err)
     boot_fail("register board", err);
 
 #ifdef FROTH_HAS_SNAPSHOTS
-  err = froth_ffi_register(&froth_vm, froth_snapshot_prims);
+  err = register_table(froth_snapshot_prims);
   if (err)
     boot_fail("register snapshot prims", err);
 #endif
 
+#ifdef FROTH_GC
+  err = register_table(froth_gc_prims);
+  if (err)
+    boot_fail("register gc prims", err);
+#endif
+
+#ifdef FROTH_MEM_STATS
+  err = register_table(froth_mem_prims);
+  if (err)
+    boot_fail("register memory prims", err);
+#endif
+
+#ifdef FROTH_ARRAYS
+  err = register_table(froth_array_prims);
+  if (err)
+    boot_fail("register array prims", err);
+#endif
+
+#ifdef FROTH_MAPS
+  err = register_table(froth_map_prims);
+  if (err)
+    boot_fail("register map prims", err);
+#endif
+
+#ifdef FROTH_RINGS
+  err = register_table(froth_ring_prims);
+  if (err)
+    boot_fail("register ring prims", err);
+#endif
+
+#ifdef FROTH_PROFILE
+  err = register_table(froth_profile_prims);
+  if (err)
+    boot_fail("register profiler prims", err);
+#endif
+
   err = platform_init();
   if (err)
     boot_fail("platform init", err);
 
   froth_tbuf_init(&froth_vm);
 
+  /* Words compiled at build time (ADR-056) are bound before the text that
+   * uses them is evaluated. */
+  err = register_compiled(froth_lib_core_aot, froth_lib_core_aot_exact);
+  if (err)
+    boot_fail("register compiled stdlib", err);
+
+#ifndef FROTH_BOOT_IMAGE
   err = froth_evaluate_input(froth_lib_core, &froth_vm);
   if (err)
     boot_fail("stdlib load", err);
+#endif
 
 #ifdef FROTH_HAS_BOARD_LIB
+  err = register_compiled(froth_board_lib_aot, froth_board_lib_aot_exact);
+  if (err)
+    boot_fail("register compiled boardlib", err);
+
+#ifndef FROTH_BOOT_IMAGE
   err = froth_evaluate_input(froth_board_lib, &froth_vm);
   if (err)
     boot_fail("froth boardlib load", err);
 #endif
+#endif
+
+  /* The autorun slot is looked up after boot. Name it below the watermark,
+   * or dangerous-reset and restore would free its name. */
+  froth_cell_u_t autorun_slot;
+  err = froth_slot_find_name_or_create(&froth_vm.heap, "autorun",
+                                       &autorun_slot);
+  if (err)
+    boot_fail("create autorun slot", err);
+}
+
+void froth_boot(const froth_ffi_entry_t *board_bindings) {
+  bool safe_boot = false; // Whether we skip restore & autorun
+
+  froth_boot_base(board_bindings);
 
   froth_vm.boot_complete = 1;
   froth_vm.watermark_heap_offset = froth_vm.heap.pointer;
@@ -102,7 +199,7 @@ void froth_boot(const froth_ffi_entry_t *board_bindings) {
 #endif
 #ifdef FROTH_HAS_USER_PROGRAM
     if (!restored) {
-      err = froth_evaluate_input(froth_user_program, &froth_vm);
+      froth_error_t err = froth_evaluate_input(froth_user_program, &froth_vm);
       if (err)
         boot_fail("user program load", err);
     }
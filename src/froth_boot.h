@@ -6,3 +6,9 @@
  * run autorun, start REPL. This is a convenience wrapper around public
  * functions — copy and modify if you need custom boot ordering. */
 void froth_boot(const froth_ffi_entry_t *board_bindings);
+
+/* The part of froth_boot below the watermark: register the primitive
+ * tables, init the platform and load the stdlib and board lib, or copy
+ * them from the boot image (ADR-071). The image generator runs this on the
+ * host and dumps what it leaves. */
+void froth_boot_base(const froth_ffi_entry_t *board_bindings);
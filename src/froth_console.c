@@ -412,6 +412,7 @@ froth_error_t froth_console_start(froth_vm_t *vm) {
 
     if (g_console.mode == FROTH_CONSOLE_LIVE) {
       if (lease_expired(g_console.lease_deadline_ms)) {
+        froth_link_eval_abort(vm);
         enter_direct_mode(&g_console);
         in_frame = 0;
         FROTH_TRY(emit_string(prompt_normal));
@@ -482,6 +483,7 @@ froth_error_t froth_console_start(froth_vm_t *vm) {
             continue;
           }
           froth_link_frame_reset();
+          froth_link_eval_abort(vm);
           enter_direct_mode(&g_console);
           in_frame = 0;
 
@@ -559,7 +561,7 @@ froth_error_t froth_console_start(froth_vm_t *vm) {
     FROTH_TRY(froth_repl_accept_byte(vm, (char)byte, &reader_state));
     if (reader_state == 1) {
       FROTH_TRY(froth_repl_evaluate(vm));
-      FROTH_TRY(emit_string(prompt_normal));
+      FROTH_TRY(froth_repl_prompt());
     }
   }
 }
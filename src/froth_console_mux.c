@@ -76,7 +76,7 @@ froth_error_t froth_console_mux_start(froth_vm_t *vm) {
 
     if (reader_state == 1) {
       FROTH_TRY(froth_repl_evaluate(vm));
-      FROTH_TRY(emit_string(prompt_normal));
+      FROTH_TRY(froth_repl_prompt());
     }
   }
 }
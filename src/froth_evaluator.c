@@ -1,4 +1,9 @@
+#include "froth_evaluator.h"
+#include "froth_body.h"
 #include "froth_executor.h"
+#include "froth_fuse.h"
+#include "froth_gc.h"
+#include "froth_intern.h"
 #include "froth_primitives.h"
 #include "froth_reader.h"
 #include "froth_slot_table.h"
@@ -6,29 +11,18 @@
 #include "froth_tbuf.h"
 #include "froth_types.h"
 #include "froth_vm.h"
+#include "froth_vocab.h"
 #include <stddef.h>
 #include <string.h>
 
-/* Resolve a name to a slot index, creating the slot if it doesn't exist yet. */
-static froth_error_t resolve_or_create_slot(const char *name,
+/* Resolve a name to a slot index through the vocabulary search order
+ * (ADR-068), creating the slot in the current vocabulary if it doesn't exist
+ * yet. */
+static froth_error_t resolve_or_create_slot(froth_token_t token,
                                             froth_heap_t *heap,
                                             froth_cell_u_t *slot_index) {
-  froth_error_t err = froth_slot_find_name(name, slot_index);
-  if (err == FROTH_ERROR_UNDEFINED_WORD) {
-    FROTH_TRY(froth_slot_create(name, heap, slot_index));
-  } else if (err != FROTH_OK) {
-    return err;
-  }
-  return FROTH_OK;
-}
-
-/* Handle a number token: tag it and push onto DS. */
-static froth_error_t froth_evaluator_handle_number(froth_token_t token,
-                                                   froth_vm_t *vm) {
-  froth_cell_t cell;
-  FROTH_TRY(froth_make_cell(token.number, FROTH_NUMBER, &cell));
-  FROTH_TRY(froth_stack_push(&vm->ds, cell));
-  return FROTH_OK;
+  return froth_vocab_find_or_create(heap, token.text, token.length,
+                                    slot_index);
 }
 
 /* Handle a bare identifier at top level: find slot, then invoke.
@@ -36,7 +30,7 @@ static froth_error_t froth_evaluator_handle_number(froth_token_t token,
 static froth_error_t froth_evaluator_handle_identifier(froth_token_t token,
                                                        froth_vm_t *vm) {
   froth_cell_u_t slot_index;
-  FROTH_TRY(froth_slot_find_name(token.name, &slot_index));
+  FROTH_TRY(froth_vocab_find(token.text, token.length, &slot_index));
   FROTH_TRY(froth_execute_slot(vm, slot_index));
   return FROTH_OK;
 }
@@ -45,147 +39,65 @@ static froth_error_t
 froth_evaluator_handle_tick_identifier(froth_token_t token, froth_vm_t *vm,
                                        froth_cell_t *output_cell) {
   froth_cell_u_t slot_index;
-  FROTH_TRY(resolve_or_create_slot(token.name, &vm->heap, &slot_index));
+  FROTH_TRY(resolve_or_create_slot(token, &vm->heap, &slot_index));
   FROTH_TRY(froth_make_cell(slot_index, FROTH_SLOT, output_cell));
   return FROTH_OK;
 }
 
-/* Count direct body cells in a quotation without consuming the reader.
- * Called after "[" has been consumed. Counts each nested quotation as 1.
- * Saves and restores reader position so the build pass can re-read.
- * Propagates reader errors so callers get the real error, not "unterminated".
- */
-static froth_error_t count_quote_body(froth_reader_t *reader,
-                                      froth_cell_u_t *out_count) {
-  froth_reader_t saved = *reader;
-  froth_cell_u_t count = 0;
-  froth_token_t token;
-  froth_error_t err;
-
-  for (;;) {
-    err = froth_reader_next_token(reader, &token);
-    if (err != FROTH_OK) {
-      *reader = saved;
-      return err;
-    }
-    if (token.type == FROTH_TOKEN_EOF ||
-        token.type == FROTH_TOKEN_CLOSE_BRACKET)
-      break;
-    count++;
-    if (token.type == FROTH_TOKEN_OPEN_BRACKET ||
-        token.type == FROTH_TOKEN_OPEN_PAT) {
-      froth_cell_u_t depth = 1;
-      while (depth > 0) {
-        err = froth_reader_next_token(reader, &token);
-        if (err != FROTH_OK) {
-          *reader = saved;
-          return err;
-        }
-        if (token.type == FROTH_TOKEN_EOF)
-          break;
-        if (token.type == FROTH_TOKEN_OPEN_BRACKET) {
-          depth++;
-        }
-        if (token.type == FROTH_TOKEN_OPEN_PAT) {
-          depth++;
-        }
-        if (token.type == FROTH_TOKEN_CLOSE_BRACKET) {
-          depth--;
-        }
-      }
-    }
+/* The object in *cell was built from mark up. Share an equal one instead,
+ * if interned (ADR-061), and free the copy unless a slot name was created
+ * on the heap while it was built. */
+static void intern_built(froth_vm_t *vm, froth_cell_t *cell,
+                         froth_cell_u_t mark, froth_cell_u_t slots) {
+  froth_cell_t existing;
+  if (!froth_intern(vm, *cell, &existing))
+    return;
+  *cell = existing;
+  if (froth_slot_count() == slots) {
+    vm->heap.pointer = mark;
+    froth_intern_forget_from(mark);
   }
-
-  *reader = saved;
-  *out_count = count;
-  return FROTH_OK;
 }
 
-static froth_error_t
-count_and_typecheck_pattern_body(froth_reader_t *reader,
-                                 froth_cell_u_t *out_count) {
-  froth_reader_t saved = *reader;
-  froth_cell_u_t count = 0;
-  froth_token_t token;
-
-  // First count the pattern body
-  while (froth_reader_next_token(reader, &token) == FROTH_OK &&
-         token.type != FROTH_TOKEN_EOF &&
-         token.type != FROTH_TOKEN_CLOSE_BRACKET) {
-
-    switch (token.type) {
-    case FROTH_TOKEN_IDENTIFIER:
-      if (!(token.name[1] == '\0' && token.name[0] >= 'a' &&
-            token.name[0] <= 'z')) {
-        *reader = saved;
-        return FROTH_ERROR_PATTERN_INVALID;
-      }
-      break;
-    case FROTH_TOKEN_NUMBER:
-      if (token.number > 255 || token.number < 0) {
-        *reader = saved;
-        return FROTH_ERROR_PATTERN_INVALID; // Only allow numbers that fit in a
-                                            // byte
-      }
-      break; // Numbers are fine
-    default:
-      *reader = saved;
-      return FROTH_ERROR_PATTERN_INVALID; // Other token types not allowed in
-                                          // pattern body
-    }
-
-    count++;
+/* Add one element of an open "p[ ... ]": a letter a-z or a byte-sized
+ * number. Past FROTH_MAX_PERM_SIZE elements are still checked, so an
+ * invalid element wins over a pattern that is too long. */
+static froth_error_t pattern_element(froth_eval_stream_t *s,
+                                     froth_token_t token) {
+  uint8_t element;
+  if (token.type == FROTH_TOKEN_IDENTIFIER && token.length == 1 &&
+      token.text[0] >= 'a' && token.text[0] <= 'z') {
+    element = (uint8_t)(token.text[0] - 'a');
+  } else if (token.type == FROTH_TOKEN_NUMBER && token.number >= 0 &&
+             token.number <= 255) {
+    element = (uint8_t)token.number;
+  } else {
+    return FROTH_ERROR_PATTERN_INVALID;
   }
-
-  if (count > FROTH_MAX_PERM_SIZE) {
-    *reader = saved;
-    return FROTH_ERROR_PATTERN_TOO_LARGE;
-  }
-
-  *reader = saved;
-  *out_count = count;
+  if (s->pattern_count < FROTH_MAX_PERM_SIZE)
+    s->pattern[s->pattern_count] = element;
+  s->pattern_count++;
   return FROTH_OK;
 }
 
-static froth_error_t
-froth_evaluator_handle_open_pat(froth_reader_t *reader, froth_vm_t *vm,
-                                froth_cell_t *output_cell) {
-  froth_token_t token;
+/* Copy the collected elements of a pattern to the heap at its "]".
+ *
+ * Heap layout: [count (1 byte)] [index bytes...] */
+static froth_error_t emit_pattern(froth_eval_stream_t *s, froth_vm_t *vm,
+                                  froth_cell_t *output_cell) {
+  froth_cell_u_t count = s->pattern_count;
   froth_cell_u_t heap_offset;
+  froth_cell_u_t mark = vm->heap.pointer;
 
-  // Count pattern length
-  froth_cell_u_t body_count;
-  FROTH_TRY(count_and_typecheck_pattern_body(reader, &body_count));
-
-  FROTH_TRY(froth_heap_allocate_bytes(
-      1 + body_count, &vm->heap,
-      &heap_offset)); // Allocate 1 byte for pattern length
-  vm->heap.data[heap_offset] = (char)body_count; // Store pattern length in heap
-
-  froth_cell_u_t heap_location =
-      heap_offset +
-      1; // Start writing pattern body immediately after length cell
-  while (froth_reader_next_token(reader, &token) == FROTH_OK &&
-         token.type != FROTH_TOKEN_CLOSE_BRACKET) {
-    if (token.type == FROTH_TOKEN_IDENTIFIER) {
-
-      char var_name = token.name[0];
-      char index = var_name - 0x61;         // Convert 'a'-'z' to 0-25
-      vm->heap.data[heap_location] = index; // Store variable name in heap
-
-    } else if (token.type == FROTH_TOKEN_NUMBER) {
-
-      vm->heap.data[heap_location] =
-          (char)(token.number &
-                 0xFF); // Store least significant byte of number in heap\e
-    }
-    heap_location++; // Increment heap location for next pattern element
-  }
+  if (count > FROTH_MAX_PERM_SIZE)
+    return FROTH_ERROR_PATTERN_TOO_LARGE;
 
-  FROTH_TRY(froth_make_cell(
-      heap_offset, FROTH_PATTERN,
-      output_cell)); // Create pattern cell with heap offset as payload
+  FROTH_TRY(froth_heap_allocate_bytes(1 + count, &vm->heap, &heap_offset));
+  vm->heap.data[heap_offset] = (uint8_t)count;
+  memcpy(&vm->heap.data[heap_offset + 1], s->pattern, count);
 
+  FROTH_TRY(froth_make_cell(heap_offset, FROTH_PATTERN, output_cell));
+  intern_built(vm, output_cell, mark, froth_slot_count());
   return FROTH_OK;
 }
 
@@ -201,188 +113,327 @@ static froth_error_t froth_evaluator_handle_bstring(froth_token_t token,
   froth_cell_t len_cell = token.bstring_len;
 
   if (is_quotation_body) { // Create a permanent cell
+    froth_cell_u_t mark = vm->heap.pointer;
     FROTH_TRY(froth_heap_allocate_bytes(
         sizeof(froth_cell_t) + token.bstring_len + 1, &vm->heap, &heap_offset));
     uint8_t *dest = &vm->heap.data[heap_offset];
 
     memcpy(dest, &len_cell, sizeof(froth_cell_t));
-    memcpy(dest + sizeof(froth_cell_t), token.bstring_bytes, token.bstring_len);
+    froth_reader_decode_string(&token, dest + sizeof(froth_cell_t));
     dest[sizeof(froth_cell_t) + token.bstring_len] = '\0';
 
     FROTH_TRY(froth_make_cell(heap_offset, FROTH_BSTRING, output_cell));
+    intern_built(vm, output_cell, mark, froth_slot_count());
     return FROTH_OK;
   } else { // Make a transient string
-    FROTH_TRY(froth_tbuf_alloc(vm, token.bstring_bytes, token.bstring_len,
-                               output_cell));
+    uint8_t *dest;
+    FROTH_TRY(froth_tbuf_reserve(vm, token.bstring_len, output_cell, &dest));
+    froth_reader_decode_string(&token, dest);
     return FROTH_OK;
   }
 }
 
-/* Build a quotation from the token stream. Called after "[" has been consumed.
- * Uses two passes: first counts direct body cells, then allocates contiguously
- * and fills in the values. Nested quotations are built after the outer block,
- * so the outer body is always contiguous on the heap.
- *
- * Heap layout: [length] [body_cell_0] [body_cell_1] ... [body_cell_n-1] */
-static froth_error_t
-froth_evaluator_handle_open_bracket(froth_reader_t *reader, froth_vm_t *vm,
-                                    froth_cell_t *output_cell) {
-  froth_token_t token;
+#ifdef FROTH_COMPACT_QUOTES
+/* Encode the collected cells as a compact body (ADR-062). A token's size
+ * depends on its value, so the body is sized from the cells first. */
+static froth_error_t emit_body(froth_vm_t *vm, froth_cell_u_t base,
+                               froth_cell_t *output_cell) {
+  froth_cell_u_t length = 0;
+  froth_cell_u_t offset;
+  froth_cell_u_t ip = 1;
+
+  for (froth_cell_u_t i = base; i < vm->ds.pointer; i++)
+    length += froth_body_encoded_size(vm->ds.data[i]);
+  FROTH_TRY(froth_body_allocate(&vm->heap, length, &offset));
+  for (froth_cell_u_t i = base; i < vm->ds.pointer; i++)
+    froth_body_put(&vm->heap, offset, &ip, vm->ds.data[i]);
+  return froth_make_cell(offset, FROTH_QUOTE, output_cell);
+}
+#else
+/* Copy the collected cells into a contiguous quotation (ADR-010). */
+static froth_error_t emit_body(froth_vm_t *vm, froth_cell_u_t base,
+                               froth_cell_t *output_cell) {
+  froth_cell_u_t count = vm->ds.pointer - base;
+  froth_cell_t *block;
+  froth_cell_u_t offset;
 
-  // Pass 1: count direct children
-  froth_cell_u_t body_count;
-  FROTH_TRY(count_quote_body(reader, &body_count));
+  FROTH_TRY(froth_heap_allocate_cells(1 + count, &vm->heap, &block, &offset));
+  block[0] = (froth_cell_t)count;
+  memcpy(&block[1], &vm->ds.data[base], count * sizeof(froth_cell_t));
+  FROTH_TRY(froth_make_cell(offset, FROTH_QUOTE, output_cell));
+  froth_fuse_quote(vm, *output_cell);
+  return FROTH_OK;
+}
+#endif
+
+#ifdef FROTH_CONST_FOLD
+/* A call to a kernel number word whose operands are literals already in
+ * the body is built as its result instead (ADR-073). Results are literals
+ * too, so "3 4 + 2 *" folds to "14". The check is on the slot's C function:
+ * a kernel primitive can't be redefined, and a shadowing word is another
+ * slot, so a folded call could only ever have computed the same value. */
+static bool fold_call(froth_vm_t *vm, froth_cell_u_t base,
+                      froth_cell_u_t slot_index) {
+  const froth_slot_t *slot = froth_slot_entry(slot_index);
+  froth_cell_u_t arity;
+  froth_cell_t result;
+
+  if (slot->prim == NULL ||
+      !froth_prim_fold(slot->prim, &vm->ds.data[vm->ds.pointer],
+                       vm->ds.pointer - base, &arity, &result))
+    return false;
+  vm->ds.pointer -= arity - 1;
+  vm->ds.data[vm->ds.pointer - 1] = result;
+  return true;
+}
+#endif
+
+/* Push a cell: a value at top level, or the next cell of the innermost
+ * open body. A body that outgrows the free DS is QUOTE_TOO_LARGE, not a
+ * STACK_OVERFLOW of the program's own. */
+static froth_error_t push_cell(froth_eval_stream_t *s, froth_vm_t *vm,
+                               froth_cell_t cell) {
+  froth_error_t err = froth_stack_push(&vm->ds, cell);
+  if (err == FROTH_ERROR_STACK_OVERFLOW && s->depth > 0)
+    return FROTH_ERROR_QUOTE_TOO_LARGE;
+  return err;
+}
 
-  // Allocate contiguous block: 1 length cell + body_count body cells
-  froth_cell_t *block;
-  froth_cell_u_t block_offset;
-  FROTH_TRY(froth_heap_allocate_cells(1 + body_count, &vm->heap, &block,
-                                      &block_offset));
-
-  block[0] = body_count;
-  froth_cell_u_t body_index = 0;
-
-  // Pass 2: fill in body cells
-  while (froth_reader_next_token(reader, &token) == FROTH_OK &&
-         token.type != FROTH_TOKEN_EOF &&
-         token.type != FROTH_TOKEN_CLOSE_BRACKET) {
-    switch (token.type) {
-    case FROTH_TOKEN_NUMBER:
-      FROTH_TRY(
-          froth_make_cell(token.number, FROTH_NUMBER, &block[1 + body_index]));
-      body_index++;
-      break;
+/* Open a quotation body. Its cells collect on the DS, which serves as the
+ * builder's scratch stack (ADR-069), until its "]". While any body is open
+ * the collector holds off, because the frames keep heap offsets. */
+static froth_error_t open_body(froth_eval_stream_t *s, froth_vm_t *vm) {
+  if (s->depth == FROTH_EVAL_NEST_MAX)
+    return FROTH_ERROR_QUOTE_TOO_DEEP;
+  froth_eval_frame_t *frame = &s->frames[s->depth];
+  frame->base = vm->ds.pointer;
+  frame->mark = vm->heap.pointer;
+  frame->slots = froth_slot_count();
+  if (s->depth == 0) {
+    s->define = false;
+    froth_gc_hold(vm);
+  }
+  s->depth++;
+  return FROTH_OK;
+}
 
-    case FROTH_TOKEN_IDENTIFIER: {
-      froth_cell_u_t slot_index;
-      FROTH_TRY(resolve_or_create_slot(token.name, &vm->heap, &slot_index));
-      FROTH_TRY(
-          froth_make_cell(slot_index, FROTH_CALL, &block[1 + body_index]));
-      body_index++;
-      break;
-    }
+/* Close the innermost body at its "]": write it to the heap in one piece
+ * and push the quotation in place of its cells. Nested objects were built
+ * as they were read, so the body itself is always contiguous.
+ *
+ * Heap layout: [nested objects...] [length] [body] */
+static froth_error_t close_body(froth_eval_stream_t *s, froth_vm_t *vm) {
+  froth_eval_frame_t *frame = &s->frames[s->depth - 1];
+  froth_cell_t quote_cell;
+
+  FROTH_TRY(emit_body(vm, frame->base, &quote_cell));
+  vm->ds.pointer = frame->base;
+  intern_built(vm, &quote_cell, frame->mark, frame->slots);
+  if (--s->depth == 0)
+    froth_gc_release(vm);
+  FROTH_TRY(push_cell(s, vm, quote_cell));
+
+  if (s->depth == 0 && s->define) {
+    // ": name body ;" -- the slot cell sits under the quotation
+    s->define = false;
+    FROTH_TRY(froth_prim_def(vm));
+  }
+  return FROTH_OK;
+}
 
-    case FROTH_TOKEN_OPEN_BRACKET: {
-      froth_cell_t nested_quote;
-      FROTH_TRY(froth_evaluator_handle_open_bracket(reader, vm, &nested_quote));
-      block[1 + body_index] = nested_quote;
-      body_index++;
-      break;
-    }
+/* Dispatch one token. At top level a name runs and a string is transient;
+ * inside a body a name becomes a call and a string is permanent. Anything
+ * else pushes one cell either way. */
+static froth_error_t stream_token(froth_eval_stream_t *s, froth_token_t token,
+                                  froth_vm_t *vm) {
+  froth_cell_t cell;
+  froth_cell_u_t slot_index;
 
-    case FROTH_TOKEN_TICK_IDENTIFIER: {
-      FROTH_TRY(froth_evaluator_handle_tick_identifier(token, vm,
-                                                       &block[1 + body_index]));
-      body_index++;
-      break;
-    }
+  if (s->in_pattern) {
+    if (token.type != FROTH_TOKEN_CLOSE_BRACKET)
+      return pattern_element(s, token);
+    s->in_pattern = false;
+    FROTH_TRY(emit_pattern(s, vm, &cell));
+    return push_cell(s, vm, cell);
+  }
 
-    case FROTH_TOKEN_OPEN_PAT: {
-      froth_cell_t pattern_cell;
-      FROTH_TRY(froth_evaluator_handle_open_pat(reader, vm, &pattern_cell));
-      block[1 + body_index] = pattern_cell;
-      body_index++;
-      break;
-    }
+  if (s->expect_name) {
+    // ": name" -- push the slot, then open the body that "def" binds to it
+    s->expect_name = false;
+    if (token.type != FROTH_TOKEN_IDENTIFIER)
+      return FROTH_ERROR_TYPE_MISMATCH; // Expect a slot name after ":"
+    FROTH_TRY(froth_vocab_define(&vm->heap, token.text, token.length,
+                                 &slot_index));
+    FROTH_TRY(froth_make_cell(slot_index, FROTH_SLOT, &cell));
+    FROTH_TRY(froth_stack_push(&vm->ds, cell));
+    FROTH_TRY(open_body(s, vm));
+    s->define = true;
+    return FROTH_OK;
+  }
 
-    case FROTH_TOKEN_BSTRING: {
-      froth_cell_t string_cell;
-      FROTH_TRY(froth_evaluator_handle_bstring(token, vm, &string_cell, true));
-      block[1 + body_index] = string_cell;
-      body_index++;
+  switch (token.type) {
+  case FROTH_TOKEN_NUMBER:
+    FROTH_TRY(froth_make_cell(token.number, FROTH_NUMBER, &cell));
+    break;
+  case FROTH_TOKEN_IDENTIFIER:
+    if (s->depth > 0) {
+      FROTH_TRY(resolve_or_create_slot(token, &vm->heap, &slot_index));
+#ifdef FROTH_CONST_FOLD
+      if (fold_call(vm, s->frames[s->depth - 1].base, slot_index))
+        return FROTH_OK;
+#endif
+      FROTH_TRY(froth_make_cell(slot_index, FROTH_CALL, &cell));
       break;
     }
-
-    default:
-      break;
+    // A single ":" at top level starts a definition.
+    if (token.length == 1 && token.text[0] == ':') {
+      s->expect_name = true;
+      return FROTH_OK;
     }
+    return froth_evaluator_handle_identifier(token, vm);
+  case FROTH_TOKEN_TICK_IDENTIFIER:
+    FROTH_TRY(froth_evaluator_handle_tick_identifier(token, vm, &cell));
+    break;
+  case FROTH_TOKEN_OPEN_BRACKET:
+    return open_body(s, vm);
+  case FROTH_TOKEN_OPEN_PAT:
+    s->in_pattern = true;
+    s->pattern_count = 0;
+    return FROTH_OK;
+  case FROTH_TOKEN_BSTRING:
+    FROTH_TRY(froth_evaluator_handle_bstring(token, vm, &cell, s->depth > 0));
+    break;
+  case FROTH_TOKEN_CLOSE_BRACKET:
+    if (s->depth == 0)
+      return FROTH_ERROR_UNEXPECTED_BRACKET;
+    return close_body(s, vm);
+  default:
+    return FROTH_OK;
   }
+  return push_cell(s, vm, cell);
+}
 
-  if (token.type == FROTH_TOKEN_CLOSE_BRACKET) {
-    FROTH_TRY(froth_make_cell(block_offset, FROTH_QUOTE, output_cell));
-    return FROTH_OK;
+/* Forget everything but the pending buffer, and reset the reader's
+ * comment state. */
+static void stream_clear(froth_eval_stream_t *s) {
+  froth_reader_init(&s->reader, "");
+  s->pending_len = 0;
+  s->depth = 0;
+  s->define = false;
+  s->expect_name = false;
+  s->in_pattern = false;
+  s->pattern_count = 0;
+}
+
+void froth_eval_stream_init(froth_eval_stream_t *stream, char *pending,
+                            froth_cell_u_t pending_cap) {
+  stream->pending = pending;
+  stream->pending_cap = pending != NULL ? pending_cap : 0;
+  stream_clear(stream);
+}
+
+void froth_eval_stream_abort(froth_eval_stream_t *stream, froth_vm_t *vm) {
+  if (stream->depth > 0) {
+    // The DS returns to its depth before the outermost "[" or ":"
+    vm->ds.pointer = stream->frames[0].base;
+    if (stream->define)
+      vm->ds.pointer--;
+    froth_gc_release(vm);
   }
+  stream_clear(stream);
+}
 
-  return FROTH_ERROR_UNTERMINATED_QUOTE;
+bool froth_eval_stream_idle(const froth_eval_stream_t *stream) {
+  return stream->depth == 0 && !stream->expect_name && !stream->in_pattern &&
+         stream->pending_len == 0 && stream->reader.comment_depth == 0 &&
+         !stream->reader.line_comment;
 }
 
-/* Top-level evaluator. Reads tokens from input and dispatches each one. */
-froth_error_t froth_evaluate_input(const char *input, froth_vm_t *vm) {
-  froth_reader_t reader;
+/* Read every token of one chunk. A token the chunk's end cut off waits in
+ * the pending buffer; the next chunk completes it there first and goes on
+ * from the bytes that follow it. */
+static froth_error_t feed_chunk(froth_eval_stream_t *s, const char *input,
+                                froth_cell_u_t length, bool final,
+                                froth_vm_t *vm) {
   froth_token_t token;
+  froth_cell_u_t offset = 0;
+
+  if (s->pending_len > 0) {
+    froth_cell_u_t kept = s->pending_len;
+    froth_cell_u_t room = s->pending_cap - kept;
+    froth_cell_u_t n = length < room ? length : room;
+
+    memcpy(s->pending + kept, input, n);
+    froth_reader_feed(&s->reader, s->pending, kept + n, final && n == length);
+    FROTH_TRY(froth_reader_next_token(&s->reader, &token));
+    if (token.type == FROTH_TOKEN_EOF) {
+      if (n < length)
+        return FROTH_ERROR_TOKEN_TOO_LONG;
+      s->pending_len = kept + n;
+      return FROTH_OK;
+    }
+    s->pending_len = 0;
+    offset = s->reader.position - kept;
+    FROTH_TRY(stream_token(s, token, vm));
+  }
 
-  froth_reader_init(&reader, input);
-
+  froth_reader_feed(&s->reader, input + offset, length - offset, final);
   for (;;) {
-    FROTH_TRY(froth_reader_next_token(&reader, &token));
+    /* Between top-level tokens nothing but the VM refers to the heap, so
+     * this is a collector safe point (ADR-059). An open body holds the
+     * collector off. */
+    if (froth_gc_due(vm) && vm->trampoline_depth == 0)
+      froth_gc_poll(vm);
+    FROTH_TRY(froth_reader_next_token(&s->reader, &token));
     if (token.type == FROTH_TOKEN_EOF)
       break;
-    switch (token.type) {
-    case FROTH_TOKEN_NUMBER:
-      FROTH_TRY(froth_evaluator_handle_number(token, vm));
-      break;
-    case FROTH_TOKEN_IDENTIFIER:
-      // Special case for slot definition: if the identifier is a single ":",
-      // treat it as a definition marker and create the next token as a slot
-      // name.
-      if (token.name[0] == ':' && token.name[1] == '\0') {
-        froth_token_t next_token;
-        froth_cell_u_t slot_index;
-        froth_cell_t slot_cell, quote_cell;
-        if (froth_reader_next_token(&reader, &next_token) != FROTH_OK ||
-            next_token.type != FROTH_TOKEN_IDENTIFIER) {
-          return FROTH_ERROR_TYPE_MISMATCH; // Expect a slot name after ":"
-        }
-        FROTH_TRY(
-            resolve_or_create_slot(next_token.name, &vm->heap, &slot_index));
-        FROTH_TRY(froth_make_cell(
-            slot_index, FROTH_SLOT,
-            &slot_cell)); // Create a Slot cell with the slot index
-        FROTH_TRY(froth_stack_push(
-            &vm->ds, slot_cell)); // Push slot name as string for definition
-
-        FROTH_TRY(
-            froth_evaluator_handle_open_bracket(&reader, vm, &quote_cell));
-        FROTH_TRY(froth_stack_push(
-            &vm->ds, quote_cell)); // Push quotation for definition
-
-        FROTH_TRY(froth_prim_def(
-            vm)); // Call the 'def' primitive to bind the slot to the quotation
-        break;
-      }
-      FROTH_TRY(froth_evaluator_handle_identifier(token, vm));
-      break;
-    case FROTH_TOKEN_OPEN_BRACKET: {
-      froth_cell_t quote_cell;
-      FROTH_TRY(froth_evaluator_handle_open_bracket(&reader, vm, &quote_cell));
-      FROTH_TRY(froth_stack_push(&vm->ds, quote_cell));
-      break;
-    }
-    case FROTH_TOKEN_TICK_IDENTIFIER: {
-      froth_cell_t slot_ref_cell;
-      FROTH_TRY(
-          froth_evaluator_handle_tick_identifier(token, vm, &slot_ref_cell));
-      FROTH_TRY(froth_stack_push(&vm->ds, slot_ref_cell));
-      break;
-    }
-    case FROTH_TOKEN_OPEN_PAT: {
-      froth_cell_t pattern_cell;
-      FROTH_TRY(froth_evaluator_handle_open_pat(&reader, vm, &pattern_cell));
-      FROTH_TRY(froth_stack_push(&vm->ds, pattern_cell));
-      break;
-    }
-    case FROTH_TOKEN_BSTRING: {
-      froth_cell_t string_cell;
-      FROTH_TRY(froth_evaluator_handle_bstring(token, vm, &string_cell, false));
-      FROTH_TRY(froth_stack_push(&vm->ds, string_cell));
-      break;
-    }
-    case FROTH_TOKEN_CLOSE_BRACKET:
-      return FROTH_ERROR_UNEXPECTED_BRACKET;
-    default:
-      break;
-    }
+    FROTH_TRY(stream_token(s, token, vm));
   }
 
+  froth_cell_u_t rest = s->reader.length - s->reader.position;
+  if (rest > 0) {
+    if (rest > s->pending_cap)
+      return FROTH_ERROR_TOKEN_TOO_LONG;
+    memcpy(s->pending, s->reader.input + s->reader.position, rest);
+    s->pending_len = rest;
+  }
+
+  if (final) {
+    if (s->depth > 0 || s->in_pattern)
+      return FROTH_ERROR_UNTERMINATED_QUOTE;
+    if (s->expect_name)
+      return FROTH_ERROR_TYPE_MISMATCH;
+  }
   return FROTH_OK;
 }
+
+static froth_error_t stream_run(froth_eval_stream_t *s, const char *input,
+                                froth_cell_u_t length, bool final,
+                                froth_vm_t *vm) {
+  froth_error_t err = feed_chunk(s, input, length, final, vm);
+  if (err != FROTH_OK)
+    froth_eval_stream_abort(s, vm);
+  else if (final)
+    stream_clear(s);
+  return err;
+}
+
+froth_error_t froth_eval_stream_feed(froth_eval_stream_t *stream,
+                                     const char *input, froth_cell_u_t length,
+                                     froth_vm_t *vm) {
+  return stream_run(stream, input, length, false, vm);
+}
+
+froth_error_t froth_eval_stream_end(froth_eval_stream_t *stream,
+                                    froth_vm_t *vm) {
+  return stream_run(stream, "", 0, true, vm);
+}
+
+/* Top-level evaluator: the whole input is one final chunk, so no token is
+ * ever cut off and no pending buffer is needed. */
+froth_error_t froth_evaluate_input(const char *input, froth_vm_t *vm) {
+  froth_eval_stream_t stream;
+
+  froth_eval_stream_init(&stream, NULL, 0);
+  return stream_run(&stream, input, strlen(input), true, vm);
+}
@@ -1,5 +1,64 @@
 #pragma once
 
+#include "froth_primitives.h"
+#include "froth_reader.h"
 #include "froth_types.h"
+#include <stdbool.h>
 
+/* Deepest nesting of quotation bodies being built at once. */
+#ifndef FROTH_EVAL_NEST_MAX
+#define FROTH_EVAL_NEST_MAX 16
+#endif
+
+/* Bytes a stream keeps of a token that the end of a chunk cut off: the
+ * longest string literal, every byte escaped, with its quotes. */
+#define FROTH_EVAL_PENDING_SIZE (2 * FROTH_STRING_MAX_LEN + 2)
+
+/* A quotation body being built (ADR-069). */
+typedef struct {
+  froth_cell_u_t base;  // DS depth where its cells start
+  froth_cell_u_t mark;  // heap pointer when it opened
+  froth_cell_u_t slots; // slot count when it opened
+} froth_eval_frame_t;
+
+/* Evaluator state between the chunks of one source (ADR-072). Partial
+ * tokens, open bodies, an open pattern and a pending ":" carry over from
+ * one chunk to the next. */
+typedef struct {
+  froth_reader_t reader;       // comment state
+  char *pending;               // start of a token cut off by the last chunk
+  froth_cell_u_t pending_len;
+  froth_cell_u_t pending_cap;
+  froth_eval_frame_t frames[FROTH_EVAL_NEST_MAX];
+  froth_cell_u_t depth;        // open bodies
+  bool define;                 // frames[0] was opened by ":"
+  bool expect_name;            // ":" read, its name not yet
+  bool in_pattern;             // inside "p[ ... ]"
+  froth_cell_u_t pattern_count;
+  uint8_t pattern[FROTH_MAX_PERM_SIZE];
+} froth_eval_stream_t;
+
+/* Evaluate a whole NUL-terminated source. */
 froth_error_t froth_evaluate_input(const char* input, froth_vm_t* vm);
+
+/* Start a stream. pending holds a token cut off between chunks and should
+ * be FROTH_EVAL_PENDING_SIZE bytes; a shorter buffer limits such tokens. */
+void froth_eval_stream_init(froth_eval_stream_t* stream, char* pending,
+                            froth_cell_u_t pending_cap);
+
+/* Evaluate the next chunk. Complete top-level forms run as soon as they are
+ * read. On error the stream starts over, and the DS drops any cells of the
+ * bodies that were open. */
+froth_error_t froth_eval_stream_feed(froth_eval_stream_t* stream,
+                                     const char* input, froth_cell_u_t length,
+                                     froth_vm_t* vm);
+
+/* End the source. An open body, pattern, string or comment is an error. */
+froth_error_t froth_eval_stream_end(froth_eval_stream_t* stream,
+                                    froth_vm_t* vm);
+
+/* Drop whatever the stream holds, as after an error. */
+void froth_eval_stream_abort(froth_eval_stream_t* stream, froth_vm_t* vm);
+
+/* True between top-level forms: nothing carries over to the next chunk. */
+bool froth_eval_stream_idle(const froth_eval_stream_t* stream);
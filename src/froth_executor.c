@@ -1,34 +1,94 @@
 #include "froth_executor.h"
+#include "froth_body.h"
 #include "froth_console.h"
+#include "froth_fuse.h"
+#include "froth_gc.h"
+#include "froth_jit.h"
+#include "froth_primitives.h"
+#include "froth_profile.h"
 #include "froth_slot_table.h"
 #include "froth_stack.h"
+#include "froth_verify.h"
 #include "platform.h"
 
 /*
- * FROTH_REENTRY_DEPTH_MAX limits how many times froth_execute_quote can
- * be re-entered from C code (via primitives like while, catch, call).
+ * Dispatch mode (ADR-049).
  *
- * This is NOT the same as the Froth call depth. Word-calls-word through
- * FROTH_CALL tags in quotation bodies are handled by the trampoline's
- * CS frames and cost zero C stack. But when a C primitive (while, catch,
- * call, etc.) needs to evaluate a quotation, it calls froth_execute_quote
- * from C, which adds a real C stack frame (~40-60 bytes on ARM).
+ * With FROTH_DIRECT_THREADED, a FROTH_CALL cell dispatches on the slot's
+ * code field (one byte, maintained by the slot table setters) instead of
+ * probing froth_slot_get_prim and froth_slot_get_impl in turn. On GCC and
+ * Clang the tag and code-field dispatch use computed goto; other compilers
+ * fall back to an equivalent switch (also forced by FROTH_NO_COMPUTED_GOTO).
+ */
+#if defined(FROTH_DIRECT_THREADED) && defined(__GNUC__) &&                    \
+    !defined(FROTH_NO_COMPUTED_GOTO)
+#define FROTH_COMPUTED_GOTO
+#endif
+
+/*
+ * Unchecked frames (ADR-055).
  *
- * FROTH_CS_CAPACITY (default 256) bounds total Froth nesting depth.
- * FROTH_REENTRY_DEPTH_MAX (default 64) bounds C stack consumption.
- * On ESP32 with an 8KB task stack, 64 re-entries is ~3-4KB, leaving
- * room for primitives, FFI callbacks, and platform code.
+ * With FROTH_STACK_VERIFY, a call to a verified word checks the DS depth
+ * once against the word's inferred effect and runs the body in an
+ * UNCHECKED frame, whose dispatch tables send literals and binops to
+ * handlers without bounds checks. Needs computed goto: the switch fallback
+ * always runs checked.
  */
-#ifndef FROTH_REENTRY_DEPTH_MAX
-#define FROTH_REENTRY_DEPTH_MAX 64
+#if defined(FROTH_STACK_VERIFY) && defined(FROTH_COMPUTED_GOTO)
+#define FROTH_UNCHECKED_FRAMES
 #endif
 
+/*
+ * Top-of-stack caching (ADR-054).
+ *
+ * With FROTH_TOS_CACHE the trampoline keeps the top DS cell in a local
+ * (`tos`, valid while `tos_live`). The logical DS is ds.data[0..pointer)
+ * followed by tos. Literals, values, fused literal ops and FROTH_CODE_BINOP
+ * words work on the local. Everything else that can see vm->ds (prims, FFI
+ * words, fused shuffles, control frames, error unwinding) runs after the
+ * cached cell has been spilled back, so the native word ABI is unchanged.
+ */
+
 /* Push a frame onto the CS. Returns FROTH_ERROR_CALL_DEPTH on overflow. */
 static froth_error_t cs_push(froth_cs_t *cs, froth_cell_u_t quote_offset,
                              froth_cell_u_t ip) {
   if (cs->pointer >= cs->capacity)
     return FROTH_ERROR_CALL_DEPTH;
-  cs->data[cs->pointer++] = (froth_cs_frame_t){quote_offset, ip};
+  cs->data[cs->pointer++] =
+      (froth_cs_frame_t){quote_offset, ip, 0, FROTH_CS_QUOTE};
+  return FROTH_OK;
+}
+
+/* Push a quotation frame of the given kind (QUOTE or UNCHECKED). */
+static froth_error_t cs_push_body(froth_cs_t *cs, froth_cell_u_t quote_offset,
+                                  froth_cs_kind_t kind) {
+  if (cs->pointer >= cs->capacity)
+    return FROTH_ERROR_CALL_DEPTH;
+  cs->data[cs->pointer++] =
+      (froth_cs_frame_t){quote_offset, 1, 0, (uint8_t)kind};
+  return FROTH_OK;
+}
+
+/* Push a while/catch control frame (ADR-053). */
+static froth_error_t cs_push_control(froth_cs_t *cs, froth_cs_kind_t kind,
+                                     froth_cell_u_t quote_offset,
+                                     froth_cell_u_t ip,
+                                     froth_cell_u_t ds_depth) {
+  if (cs->pointer >= cs->capacity)
+    return FROTH_ERROR_CALL_DEPTH;
+  cs->data[cs->pointer++] =
+      (froth_cs_frame_t){quote_offset, ip, ds_depth, (uint8_t)kind};
+  return FROTH_OK;
+}
+
+/* Pop a quotation for while/catch. The cell is consumed even when it has
+ * the wrong type, as the C primitives always did. */
+static froth_error_t pop_quote(froth_vm_t *vm, froth_cell_u_t *offset) {
+  froth_cell_t cell;
+  FROTH_TRY(froth_stack_pop(&vm->ds, &cell));
+  if (!FROTH_CELL_IS_QUOTE(cell))
+    return FROTH_ERROR_TYPE_MISMATCH;
+  *offset = FROTH_CELL_STRIP_TAG(cell);
   return FROTH_OK;
 }
 
@@ -41,12 +101,34 @@ froth_error_t froth_execute_slot(froth_vm_t *vm, froth_cell_u_t slot_index) {
 
   froth_native_word_t prim;
   if (froth_slot_get_prim(slot_index, &prim) == FROTH_OK) {
+#ifdef FROTH_GC
+    /* A primitive may keep heap offsets in C locals while it runs Froth
+     * code, so nothing is collected under it (ADR-059). while, catch and
+     * call only hand their quotations to the trampoline. */
+    froth_code_kind_t code =
+        (froth_code_kind_t)froth_slot_entry(slot_index)->code;
+    if (code != FROTH_CODE_WHILE && code != FROTH_CODE_CATCH &&
+        code != FROTH_CODE_CALL) {
+      froth_gc_hold(vm);
+      froth_error_t err = FROTH_PROFILE_ACTIVE()
+                              ? froth_profile_run_prim(vm, slot_index, prim)
+                              : prim(vm);
+      froth_gc_release(vm);
+      return err;
+    }
+#endif
+    if (FROTH_PROFILE_ACTIVE())
+      return froth_profile_run_prim(vm, slot_index, prim);
     return prim(vm);
   }
 
   froth_cell_t impl;
   if (froth_slot_get_impl(slot_index, &impl) == FROTH_OK) {
     if (FROTH_CELL_IS_QUOTE(impl)) {
+#ifdef FROTH_PROFILE
+      if (FROTH_PROFILE_ACTIVE())
+        return froth_profile_run_quote(vm, slot_index, impl);
+#endif
       return froth_execute_quote(vm, impl);
     }
     FROTH_TRY(froth_stack_push(&vm->ds, impl));
@@ -58,11 +140,13 @@ froth_error_t froth_execute_slot(froth_vm_t *vm, froth_cell_u_t slot_index) {
 
 /* Trampoline executor. Runs a quotation body without C recursion.
  *
- * Each call to froth_execute_quote snapshots the CS pointer (cs_base)
- * and processes only frames above that base. This makes the trampoline
- * re-entrant: primitives like while, catch, and call can invoke it
- * from within a running trampoline, and each invocation uses its own
- * partition of the CS.
+ * while, catch and call do not re-enter the trampoline from C: they push
+ * CS frames and the loop resumes them when the body they started returns
+ * (ADR-053). Errors unwind to the nearest catch frame of this invocation.
+ *
+ * Each call to trampoline() snapshots the CS pointer (cs_base) and
+ * processes only frames above that base, so the executor stays re-entrant
+ * for primitives and FFI words that call back into it.
  *
  * Two depth limits apply:
  *   - CS capacity: total Froth call depth (trampoline frames + re-entries).
@@ -70,78 +154,675 @@ froth_error_t froth_execute_slot(froth_vm_t *vm, froth_cell_u_t slot_index) {
  *   - Re-entry depth: how many times this function appears on the C call
  *     stack simultaneously. Bounded by FROTH_REENTRY_DEPTH_MAX. Each
  *     re-entry costs one C stack frame. */
-froth_error_t froth_execute_quote(froth_vm_t *vm, froth_cell_t quote_cell) {
+static froth_error_t trampoline(froth_vm_t *vm, froth_cell_t quote_cell,
+                                froth_code_kind_t entry) {
   if (vm->trampoline_depth >= FROTH_REENTRY_DEPTH_MAX)
     return FROTH_ERROR_CALL_DEPTH;
   vm->trampoline_depth++;
 
+#ifdef FROTH_COMPUTED_GOTO
+  /* Indexed by the 3-bit cell tag. CONTRACT is not executable. */
+  static void *const tag_targets[8] = {
+      &&op_literal, &&op_literal, &&op_literal, &&op_literal,
+      &&op_literal, &&op_invalid, &&op_call,    &&op_ext,
+  };
+  /* Indexed by froth_code_kind_t. */
+  static void *const code_targets[8] = {
+      &&code_undefined, &&code_prim, &&code_quote, &&code_value,
+      &&ctl_while,      &&ctl_catch, &&ctl_call,   &&code_binop,
+  };
+#ifdef FROTH_UNCHECKED_FRAMES
+  /* Used in UNCHECKED frames (ADR-055). */
+  static void *const tag_targets_unchecked[8] = {
+      &&op_literal_unchecked, &&op_literal_unchecked, &&op_literal_unchecked,
+      &&op_literal_unchecked, &&op_literal_unchecked, &&op_invalid,
+      &&op_call,              &&op_ext,
+  };
+  static void *const code_targets_unchecked[8] = {
+      &&code_undefined, &&code_prim, &&code_quote, &&code_value,
+      &&ctl_while,      &&ctl_catch, &&ctl_call,   &&code_binop_unchecked,
+  };
+#endif
+  /* Tables for the current frame. */
+  void *const *tags = tag_targets;
+  void *const *codes = code_targets;
+#endif
+
   froth_cell_u_t cs_base = vm->cs.pointer;
   froth_cell_u_t rs_snapshot = froth_stack_depth(&vm->rs);
 
-  froth_cell_u_t offset = FROTH_CELL_STRIP_TAG(quote_cell);
-  froth_error_t err = cs_push(&vm->cs, offset, 1);
+  froth_cs_frame_t *frame;
+  froth_cell_t *base;
+#ifdef FROTH_COMPACT_QUOTES
+  const uint8_t *code;
+#endif
+  froth_cell_u_t length;
+  froth_cell_t cell;
+  froth_cell_u_t callee_offset;
+  froth_cell_u_t cond_offset;
+  froth_cell_u_t unwind;
+  froth_cs_kind_t callee_kind = FROTH_CS_QUOTE;
+#ifdef FROTH_JIT
+  froth_cell_u_t callee_jit = 0;
+#endif
+  froth_error_t err = FROTH_OK;
+#ifdef FROTH_TOS_CACHE
+  froth_cell_t tos = 0;
+  bool tos_live = false;
+#endif
 
-  while (vm->cs.pointer > cs_base && err == FROTH_OK) {
-    froth_cs_frame_t *frame = &vm->cs.data[vm->cs.pointer - 1];
-    froth_cell_t *base = froth_heap_cell_ptr(&vm->heap, frame->quote_offset);
-    froth_cell_u_t length = base[0];
+/* Safe point (ADR-052). The console is polled once every
+ * FROTH_SAFEPOINT_INTERVAL cells rather than before every cell: in Live mode
+ * each poll is a platform_key_ready() syscall. The budget lives in the VM so
+ * it carries across trampoline invocations. */
+#define SAFEPOINT()                                                            \
+  do {                                                                         \
+    if (vm->safepoint_budget == 0) {                                           \
+      vm->safepoint_budget = FROTH_SAFEPOINT_INTERVAL - 1;                     \
+      froth_profile_sample();                                                  \
+      froth_console_poll(vm);                                                  \
+      if (vm->interrupted != 0)                                                \
+        goto interrupted;                                                      \
+    } else {                                                                   \
+      vm->safepoint_budget--;                                                  \
+    }                                                                          \
+  } while (0)
 
-    if (frame->ip > length) {
-      vm->cs.pointer--;
-      continue;
-    }
+/* SPILL() writes a cached top cell back to vm->ds. PUSH() pushes onto the
+ * logical DS; on overflow it leaves err set for NEXT() or jumps to done. */
+#ifdef FROTH_TOS_CACHE
+#define SPILL()                                                                \
+  do {                                                                         \
+    if (tos_live) {                                                            \
+      vm->ds.data[vm->ds.pointer++] = tos;                                     \
+      tos_live = false;                                                        \
+    }                                                                          \
+  } while (0)
+#define PUSH(c)                                                                \
+  do {                                                                         \
+    if (vm->ds.pointer + tos_live >= vm->ds.capacity) {                        \
+      err = FROTH_ERROR_STACK_OVERFLOW;                                        \
+      goto done;                                                               \
+    }                                                                          \
+    if (tos_live)                                                              \
+      vm->ds.data[vm->ds.pointer++] = tos;                                     \
+    tos = (c);                                                                 \
+    tos_live = true;                                                           \
+  } while (0)
+#else
+#define SPILL()                                                                \
+  do {                                                                         \
+  } while (0)
+#define PUSH(c) err = froth_stack_push(&vm->ds, (c))
+#endif
 
-    froth_console_poll(vm);
-    if (vm->interrupted != 0) {
-      vm->interrupted = 0;
-      vm->thrown = FROTH_ERROR_PROGRAM_INTERRUPTED;
-      err = FROTH_ERROR_THROW;
-      break;
-    }
+/* FETCH() reads the cell at the frame's ip and moves past it. Compact
+ * bodies decode it from the byte code (ADR-062). */
+#ifdef FROTH_COMPACT_QUOTES
+#define FETCH() froth_body_decode(code, &frame->ip)
+#else
+#define FETCH() base[frame->ip++]
+#endif
 
-    froth_cell_t cell = base[frame->ip++];
-    froth_cell_t tag = FROTH_CELL_GET_TAG(cell);
+/* Logical DS depth, counting a cached top cell. */
+#ifdef FROTH_TOS_CACHE
+#define DEPTH() (vm->ds.pointer + tos_live)
+#else
+#define DEPTH() (vm->ds.pointer)
+#endif
 
-    switch (tag) {
-    case FROTH_NUMBER:
-    case FROTH_QUOTE:
-    case FROTH_SLOT:
-    case FROTH_BSTRING:
-    case FROTH_PATTERN:
-      err = froth_stack_push(&vm->ds, cell);
-      break;
+/* Fetch the next cell of the current frame and dispatch on its tag. With
+ * computed goto every handler ends in its own copy of this sequence, so the
+ * indirect branch at each site predicts independently. */
+#ifdef FROTH_COMPUTED_GOTO
+#define NEXT()                                                                 \
+  do {                                                                         \
+    if (err != FROTH_OK)                                                       \
+      goto done;                                                               \
+    if (frame->ip > length)                                                    \
+      goto frame_end;                                                          \
+    SAFEPOINT();                                                               \
+    cell = FETCH();                                                            \
+    goto *tags[FROTH_CELL_GET_TAG(cell)];                                      \
+  } while (0)
+#else
+#define NEXT()                                                                 \
+  do {                                                                         \
+    if (err != FROTH_OK)                                                       \
+      goto done;                                                               \
+    goto next;                                                                 \
+  } while (0)
+#endif
 
-    case FROTH_CALL: {
-      froth_cell_u_t slot_index = FROTH_CELL_STRIP_TAG(cell);
-      vm->last_error_slot = (froth_cell_t)slot_index;
+  /* froth_execute_control enters at the control word itself, with no
+   * frame of its own. */
+  switch (entry) {
+  case FROTH_CODE_WHILE:
+    goto ctl_while;
+  case FROTH_CODE_CATCH:
+    goto ctl_catch;
+  default:
+    err = cs_push(&vm->cs, FROTH_CELL_STRIP_TAG(quote_cell), 1);
+    if (err != FROTH_OK)
+      goto done;
+    break;
+  }
 
-      froth_native_word_t prim;
-      if (froth_slot_get_prim(slot_index, &prim) == FROTH_OK) {
-        err = prim(vm);
-        break;
-      }
+enter_frame:
+  /* Collector safe point (ADR-059): no heap pointer is cached until base is
+   * loaded below, and only the outermost trampoline has no C caller holding
+   * offsets. */
+  if (froth_gc_due(vm) && vm->trampoline_depth == 1) {
+    SPILL();
+    froth_gc_poll(vm);
+  }
+  frame = &vm->cs.data[vm->cs.pointer - 1];
+  if (frame->kind > FROTH_CS_UNCHECKED)
+    goto resume_control;
+  base = froth_heap_cell_ptr(&vm->heap, frame->quote_offset);
+  length = base[0];
+#ifdef FROTH_COMPACT_QUOTES
+  code = froth_body_code(&vm->heap, frame->quote_offset);
+#endif
+#ifdef FROTH_UNCHECKED_FRAMES
+  if (frame->kind == FROTH_CS_UNCHECKED) {
+    tags = tag_targets_unchecked;
+    codes = code_targets_unchecked;
+  } else {
+    tags = tag_targets;
+    codes = code_targets;
+  }
+#endif
+#ifdef FROTH_JIT
+  /* Compiled body (ADR-057): run it from the frame's ip, then interpret
+   * from wherever it stopped. */
+  if (frame->ds_depth != 0 && frame->ip <= length &&
+      !FROTH_PROFILE_ACTIVE()) {
+    SPILL();
+    SAFEPOINT();
+    err = froth_jit_run(vm, frame);
+    if (err != FROTH_OK)
+      goto done;
+  }
+#endif
+
+#ifndef FROTH_COMPUTED_GOTO
+next:
+#endif
+  if (frame->ip > length)
+    goto frame_end;
+
+  SAFEPOINT();
 
-      froth_cell_t impl;
-      if (froth_slot_get_impl(slot_index, &impl) == FROTH_OK) {
-        if (FROTH_CELL_IS_QUOTE(impl)) {
-          froth_cell_u_t callee_offset = FROTH_CELL_STRIP_TAG(impl);
-          err = cs_push(&vm->cs, callee_offset, 1);
-        } else {
-          err = froth_stack_push(&vm->ds, impl);
-        }
-      } else {
-        err = FROTH_ERROR_UNDEFINED_WORD;
+  cell = FETCH();
+
+#ifdef FROTH_COMPUTED_GOTO
+  goto *tags[FROTH_CELL_GET_TAG(cell)];
+#else
+  switch (FROTH_CELL_GET_TAG(cell)) {
+  case FROTH_NUMBER:
+  case FROTH_QUOTE:
+  case FROTH_SLOT:
+  case FROTH_BSTRING:
+  case FROTH_PATTERN:
+    goto op_literal;
+  case FROTH_CALL:
+    goto op_call;
+  case FROTH_EXT:
+    goto op_ext;
+  default:
+    goto op_invalid;
+  }
+#endif
+
+op_literal:
+  PUSH(cell);
+  NEXT();
+
+op_invalid:
+  err = FROTH_ERROR_TYPE_MISMATCH;
+  goto done;
+
+#ifdef FROTH_UNCHECKED_FRAMES
+/* The entry check in code_quote already covers this push. */
+op_literal_unchecked:
+#ifdef FROTH_TOS_CACHE
+  if (tos_live)
+    vm->ds.data[vm->ds.pointer++] = tos;
+  tos = cell;
+  tos_live = true;
+#else
+  vm->ds.data[vm->ds.pointer++] = cell;
+#endif
+  NEXT();
+#endif
+
+op_ext:
+#ifdef FROTH_SUPERINSTRUCTIONS
+  /* Fused superinstruction (ADR-050). A fused cell is never the last cell
+   * of a body, so the covered cell at frame->ip always exists. */
+  if (FROTH_CELL_IS_FUSED(cell)) {
+    /* The profiler counts the words a fused cell stands for. */
+    if (FROTH_PROFILE_ACTIVE())
+      goto fused_fallback;
+#ifdef FROTH_TOS_CACHE
+    if (tos_live) {
+      froth_cell_t top = tos;
+      if (froth_fuse_run_tos(cell, &top)) {
+        tos = top;
+        frame->ip++;
+        NEXT();
       }
-      break;
     }
+    SPILL();
+#endif
+    if (froth_fuse_run(vm, cell)) {
+      frame->ip++;
+      NEXT();
+    }
+  fused_fallback:
+    cell = froth_fuse_original(cell);
+    if (FROTH_CELL_IS_CALL(cell))
+      goto op_call;
+    goto op_literal;
+  }
+#endif
+  goto op_invalid;
+
+op_call: {
+  froth_cell_u_t slot_index = FROTH_CELL_STRIP_TAG(cell);
+  vm->last_error_slot = (froth_cell_t)slot_index;
 
+#ifdef FROTH_DIRECT_THREADED
+  const froth_slot_t *slot = froth_slot_entry(slot_index);
+#ifdef FROTH_COMPUTED_GOTO
+  goto *codes[slot->code];
+#else
+  switch (slot->code) {
+  case FROTH_CODE_PRIM:
+    goto code_prim;
+  case FROTH_CODE_QUOTE:
+    goto code_quote;
+  case FROTH_CODE_VALUE:
+    goto code_value;
+  case FROTH_CODE_WHILE:
+    goto ctl_while;
+  case FROTH_CODE_CATCH:
+    goto ctl_catch;
+  case FROTH_CODE_CALL:
+    goto ctl_call;
+  case FROTH_CODE_BINOP:
+    goto code_binop;
+  default:
+    goto code_undefined;
+  }
+#endif
+
+code_prim:
+  SPILL();
+  if (FROTH_PROFILE_ACTIVE()) {
+    err = froth_profile_run_prim(vm, slot_index, slot->prim);
+    NEXT();
+  }
+  err = slot->prim(vm);
+  NEXT();
+
+code_quote:
+  callee_offset = FROTH_CELL_STRIP_TAG(slot->impl);
+#ifdef FROTH_UNCHECKED_FRAMES
+  /* One depth check covers the whole body of a verified word (ADR-055). */
+  if (slot->verify == FROTH_VERIFY_UNKNOWN)
+    froth_verify_slot(vm, slot_index);
+  if (slot->verify == FROTH_VERIFY_OK && DEPTH() >= slot->ds_in &&
+      DEPTH() + slot->ds_peak <= vm->ds.capacity)
+    callee_kind = FROTH_CS_UNCHECKED;
+#endif
+#ifdef FROTH_JIT
+  callee_jit = froth_jit_body(vm, slot_index);
+#endif
+  goto enter_callee;
+
+code_value:
+  PUSH(slot->impl);
+  NEXT();
+
+/* Inline ( a b -- r ) through the prim's froth_binop_t. Checks run in the
+ * prim's order (pop b, check b, pop a, check a), and each operand leaves the
+ * DS before its check, so a failed check leaves the DS as the prim does. */
+code_binop: {
+  froth_cell_t a_cell, b_cell, result;
+  /* Profiled binops are timed like any other prim. */
+  if (FROTH_PROFILE_ACTIVE())
+    goto code_prim;
+#ifdef FROTH_TOS_CACHE
+  if (tos_live) {
+    b_cell = tos;
+    tos_live = false;
+  } else {
+    if (vm->ds.pointer == 0) {
+      err = FROTH_ERROR_STACK_UNDERFLOW;
+      goto done;
+    }
+    b_cell = vm->ds.data[--vm->ds.pointer];
+  }
+#else
+  if (vm->ds.pointer == 0) {
+    err = FROTH_ERROR_STACK_UNDERFLOW;
+    goto done;
+  }
+  b_cell = vm->ds.data[--vm->ds.pointer];
+#endif
+  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
+    err = FROTH_ERROR_TYPE_MISMATCH;
+    goto done;
+  }
+  if (vm->ds.pointer == 0) {
+    err = FROTH_ERROR_STACK_UNDERFLOW;
+    goto done;
+  }
+  a_cell = vm->ds.data[--vm->ds.pointer];
+  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
+    err = FROTH_ERROR_TYPE_MISMATCH;
+    goto done;
+  }
+  err = slot->binop(FROTH_CELL_STRIP_TAG(a_cell), FROTH_CELL_STRIP_TAG(b_cell),
+                    &result);
+  if (err != FROTH_OK)
+    goto done;
+#ifdef FROTH_TOS_CACHE
+  tos = result;
+  tos_live = true;
+#else
+  vm->ds.data[vm->ds.pointer++] = result;
+#endif
+  NEXT();
+}
+
+#ifdef FROTH_UNCHECKED_FRAMES
+/* code_binop in an UNCHECKED frame: both operands are known to exist, so
+ * only the type checks remain, with the same DS on failure. */
+code_binop_unchecked: {
+  froth_cell_t a_cell, b_cell, result;
+  if (FROTH_PROFILE_ACTIVE())
+    goto code_prim;
+#ifdef FROTH_TOS_CACHE
+  if (tos_live) {
+    b_cell = tos;
+    tos_live = false;
+  } else {
+    b_cell = vm->ds.data[--vm->ds.pointer];
+  }
+#else
+  b_cell = vm->ds.data[--vm->ds.pointer];
+#endif
+  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
+    err = FROTH_ERROR_TYPE_MISMATCH;
+    goto done;
+  }
+  a_cell = vm->ds.data[--vm->ds.pointer];
+  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
+    err = FROTH_ERROR_TYPE_MISMATCH;
+    goto done;
+  }
+  err = slot->binop(FROTH_CELL_STRIP_TAG(a_cell), FROTH_CELL_STRIP_TAG(b_cell),
+                    &result);
+  if (err != FROTH_OK)
+    goto done;
+#ifdef FROTH_TOS_CACHE
+  tos = result;
+  tos_live = true;
+#else
+  vm->ds.data[vm->ds.pointer++] = result;
+#endif
+  NEXT();
+}
+#endif
+
+code_undefined:
+  err = FROTH_ERROR_UNDEFINED_WORD;
+  goto done;
+#else
+  froth_native_word_t prim;
+  if (froth_slot_get_prim(slot_index, &prim) == FROTH_OK) {
+    switch (froth_prim_code(prim)) {
+    case FROTH_CODE_WHILE:
+      goto ctl_while;
+    case FROTH_CODE_CATCH:
+      goto ctl_catch;
+    case FROTH_CODE_CALL:
+      goto ctl_call;
     default:
+      SPILL();
+      if (FROTH_PROFILE_ACTIVE())
+        err = froth_profile_run_prim(vm, slot_index, prim);
+      else
+        err = prim(vm);
+      NEXT();
+    }
+  }
+
+  froth_cell_t impl;
+  if (froth_slot_get_impl(slot_index, &impl) != FROTH_OK) {
+    err = FROTH_ERROR_UNDEFINED_WORD;
+    goto done;
+  }
+  if (FROTH_CELL_IS_QUOTE(impl)) {
+    callee_offset = FROTH_CELL_STRIP_TAG(impl);
+#ifdef FROTH_JIT
+    callee_jit = froth_jit_body(vm, slot_index);
+#endif
+    goto enter_callee;
+  }
+  PUSH(impl);
+  NEXT();
+#endif
+}
+
+/* Control words (ADR-053). Each pushes a control frame under the body it
+ * starts, or for `call` simply enters the callee, and goes back to the loop
+ * without touching the C stack. */
+ctl_call:
+  SPILL();
+  err = froth_stack_pop(&vm->ds, &cell);
+  if (err != FROTH_OK)
+    goto done;
+  if (FROTH_CELL_IS_QUOTE(cell)) {
+    callee_offset = FROTH_CELL_STRIP_TAG(cell);
+    goto enter_callee;
+  }
+  if (FROTH_CELL_IS_SLOT(cell)) {
+    cell = FROTH_CELL_PACK_TAG(FROTH_CELL_STRIP_TAG(cell), FROTH_CALL);
+    goto op_call;
+  }
+  err = FROTH_ERROR_TYPE_MISMATCH;
+  goto done;
+
+ctl_while:
+  SPILL();
+  err = pop_quote(vm, &callee_offset);
+  if (err == FROTH_OK)
+    err = pop_quote(vm, &cond_offset);
+  if (err == FROTH_OK)
+    err = cs_push_control(&vm->cs, FROTH_CS_WHILE_COND, cond_offset,
+                          callee_offset, vm->ds.pointer);
+  if (err != FROTH_OK)
+    goto done;
+  /* Profiled as a word whose frame is the control frame. Entered from
+   * froth_execute_control (no caller frame), the prim is timed already. */
+  if (FROTH_PROFILE_ACTIVE() && vm->cs.pointer - 1 > cs_base)
+    froth_profile_enter_word((froth_cell_u_t)vm->last_error_slot,
+                             vm->cs.pointer - 1);
+  goto enter_frame;
+
+ctl_catch:
+  SPILL();
+  err = pop_quote(vm, &callee_offset);
+  /* A CATCH frame has no quotation: its quote_offset holds the arena
+   * depth to unwind to (ADR-060). */
+  if (err == FROTH_OK)
+    err = cs_push_control(&vm->cs, FROTH_CS_CATCH, vm->arenas.pointer,
+                          vm->rs.pointer, vm->ds.pointer);
+  if (err == FROTH_OK)
+    err = cs_push(&vm->cs, callee_offset, 1);
+  if (err != FROTH_OK)
+    goto done;
+  if (FROTH_PROFILE_ACTIVE() && vm->cs.pointer - 2 > cs_base)
+    froth_profile_enter_word((froth_cell_u_t)vm->last_error_slot,
+                             vm->cs.pointer - 2);
+  goto enter_frame;
+
+/* The body above a control frame has returned (or, for WHILE_COND, the
+ * frame was just pushed). */
+resume_control:
+  SPILL();
+  switch (frame->kind) {
+  case FROTH_CS_WHILE_COND:
+    if (vm->ds.pointer != frame->ds_depth) {
+      err = FROTH_ERROR_WHILE_STACK;
+      goto done;
+    }
+    /* A loop whose bodies run no cells still reaches a safe point. */
+    SAFEPOINT();
+    frame->kind = FROTH_CS_WHILE_TEST;
+    err = cs_push(&vm->cs, frame->quote_offset, 1);
+    if (err != FROTH_OK)
+      goto done;
+    goto enter_frame;
+
+  case FROTH_CS_WHILE_TEST:
+    if (vm->ds.pointer != frame->ds_depth + 1) {
+      err = FROTH_ERROR_WHILE_STACK;
+      goto done;
+    }
+    cell = vm->ds.data[--vm->ds.pointer];
+    if (!FROTH_CELL_IS_NUMBER(cell)) {
       err = FROTH_ERROR_TYPE_MISMATCH;
+      goto done;
+    }
+    if (FROTH_CELL_STRIP_TAG(cell) == 0)
+      goto frame_end;
+    frame->kind = FROTH_CS_WHILE_COND;
+    err = cs_push(&vm->cs, frame->ip, 1);
+    if (err != FROTH_OK)
+      goto done;
+    goto enter_frame;
+
+  default: /* FROTH_CS_CATCH: the body returned normally */
+    if (vm->rs.pointer != frame->ip) {
+      /* Same RS balance rule as a separate invocation (ADR-022). */
+      vm->last_error_slot = -1;
+      err = FROTH_ERROR_UNBALANCED_RETURN_STACK_CALLS;
+      goto done;
+    }
+    vm->cs.pointer--;
+    if (FROTH_PROFILE_ACTIVE())
+      froth_profile_leave_frames(vm->cs.pointer);
+    err = froth_stack_push(&vm->ds, FROTH_CELL_PACK_TAG(FROTH_OK, FROTH_NUMBER));
+    if (err == FROTH_OK)
+      err = froth_make_cell(FROTH_TRUE, FROTH_NUMBER, &cell);
+    if (err == FROTH_OK)
+      err = froth_stack_push(&vm->ds, cell);
+    if (err != FROTH_OK)
+      goto done;
+    if (vm->cs.pointer > cs_base)
+      goto enter_frame;
+    goto done;
+  }
+
+enter_callee:
+  /* Tail call: the CALL was the caller's last cell, so its frame has nothing
+   * left to resume. Reuse it for the callee instead of pushing on top, so
+   * tail-recursive words run in constant CS space. The frame always belongs
+   * to this invocation (it sits at or above cs_base), and the RS balance
+   * check below is per invocation, so neither is affected. */
+  if (frame->ip > length) {
+    frame->quote_offset = callee_offset;
+    frame->ip = 1;
+    frame->kind = (uint8_t)callee_kind;
+    callee_kind = FROTH_CS_QUOTE;
+#ifdef FROTH_JIT
+    frame->ds_depth = callee_jit;
+    callee_jit = 0;
+#endif
+    goto callee_entered;
+  }
+  err = cs_push_body(&vm->cs, callee_offset, callee_kind);
+  callee_kind = FROTH_CS_QUOTE;
+  if (err != FROTH_OK) {
+#ifdef FROTH_JIT
+    callee_jit = 0;
+#endif
+    goto done;
+  }
+#ifdef FROTH_JIT
+  vm->cs.data[vm->cs.pointer - 1].ds_depth = callee_jit;
+  callee_jit = 0;
+#endif
+callee_entered:
+  /* The callee's frame is on top, and a tail call has ended the caller.
+   * Every path here comes from op_call, so last_error_slot is the word
+   * being entered; for `call` its quotation is charged to `call`. */
+  if (FROTH_PROFILE_ACTIVE()) {
+    froth_profile_leave_frames(vm->cs.pointer - 1);
+    froth_profile_enter_word((froth_cell_u_t)vm->last_error_slot,
+                             vm->cs.pointer - 1);
+  }
+  goto enter_frame;
+
+frame_end:
+  vm->cs.pointer--;
+  if (FROTH_PROFILE_ACTIVE())
+    froth_profile_leave_frames(vm->cs.pointer);
+  if (vm->cs.pointer > cs_base)
+    goto enter_frame;
+  goto done;
+
+interrupted:
+  vm->interrupted = 0;
+  vm->thrown = FROTH_ERROR_PROGRAM_INTERRUPTED;
+  err = FROTH_ERROR_THROW;
+
+done:
+  SPILL();
+
+  /* Unwind to the innermost catch frame of this invocation. DS, RS, CS and
+   * open arenas go back to where they were when catch started, and the
+   * error code and a false flag are pushed (ADR-045). A reset is never
+   * caught. */
+  if (err != FROTH_OK && err != FROTH_ERROR_RESET) {
+    for (unwind = vm->cs.pointer; unwind > cs_base; unwind--) {
+      frame = &vm->cs.data[unwind - 1];
+      if (frame->kind != FROTH_CS_CATCH)
+        continue;
+      vm->ds.pointer = frame->ds_depth;
+      vm->rs.pointer = frame->ip;
+      froth_arena_unwind(vm, frame->quote_offset);
+      vm->cs.pointer = unwind - 1;
+      if (FROTH_PROFILE_ACTIVE())
+        froth_profile_leave_frames(vm->cs.pointer);
+      cell = (err == FROTH_ERROR_THROW) ? vm->thrown : (froth_cell_t)err;
+      err = froth_stack_push(&vm->ds, FROTH_CELL_PACK_TAG(cell, FROTH_NUMBER));
+      if (err == FROTH_OK)
+        err = froth_stack_push(&vm->ds,
+                               FROTH_CELL_PACK_TAG(FROTH_FALSE, FROTH_NUMBER));
+      if (err != FROTH_OK)
+        goto done;
+      if (vm->cs.pointer > cs_base)
+        goto enter_frame;
       break;
     }
   }
 
+#undef NEXT
+#undef FETCH
+#undef DEPTH
+#undef PUSH
+#undef SPILL
+#undef SAFEPOINT
+
   vm->cs.pointer = cs_base;
+  if (FROTH_PROFILE_ACTIVE())
+    froth_profile_leave_frames(cs_base);
   vm->trampoline_depth--;
 
   if (err == FROTH_OK && froth_stack_depth(&vm->rs) != rs_snapshot) {
@@ -151,3 +832,11 @@ froth_error_t froth_execute_quote(froth_vm_t *vm, froth_cell_t quote_cell) {
 
   return err;
 }
+
+froth_error_t froth_execute_quote(froth_vm_t *vm, froth_cell_t quote_cell) {
+  return trampoline(vm, quote_cell, FROTH_CODE_QUOTE);
+}
+
+froth_error_t froth_execute_control(froth_vm_t *vm, froth_code_kind_t code) {
+  return trampoline(vm, 0, code);
+}
@@ -1,7 +1,44 @@
 #pragma once
 
+#include "froth_slot_table.h"
 #include "froth_types.h"
 #include "froth_vm.h"
 
+/*
+ * FROTH_REENTRY_DEPTH_MAX limits how many times the trampoline can be
+ * re-entered from C code.
+ *
+ * This is NOT the same as the Froth call depth. Word calls, while, catch
+ * and call inside quotation bodies are handled by the trampoline's CS
+ * frames and cost zero C stack (ADR-053). Only a C primitive or FFI word
+ * that evaluates a quotation itself re-enters, which adds a real C stack
+ * frame (~40-60 bytes on ARM). Late-bound calls from build-time compiled
+ * words (ADR-056) count against the same limit.
+ *
+ * FROTH_CS_CAPACITY (default 256) bounds total Froth nesting depth.
+ * FROTH_REENTRY_DEPTH_MAX (default 64) bounds C stack consumption.
+ * On ESP32 with an 8KB task stack, 64 re-entries is ~3-4KB, leaving
+ * room for primitives, FFI callbacks, and platform code.
+ */
+#ifndef FROTH_REENTRY_DEPTH_MAX
+#define FROTH_REENTRY_DEPTH_MAX 64
+#endif
+
+/*
+ * FROTH_SAFEPOINT_INTERVAL is the number of body cells the executor runs
+ * between console polls (ADR-052). Ctrl-C, INTERRUPT_REQ and Live lease
+ * expiry are noticed within this many cells, plus the time of the slowest
+ * single primitive. 1 polls before every cell.
+ */
+#ifndef FROTH_SAFEPOINT_INTERVAL
+#define FROTH_SAFEPOINT_INTERVAL 256
+#endif
+#if FROTH_SAFEPOINT_INTERVAL < 1
+#error "FROTH_SAFEPOINT_INTERVAL must be at least 1"
+#endif
+
 froth_error_t froth_execute_quote(froth_vm_t* vm, froth_cell_t quote_cell);
 froth_error_t froth_execute_slot(froth_vm_t* vm, froth_cell_u_t slot_index);
+/* Run a control word (FROTH_CODE_WHILE or FROTH_CODE_CATCH) against the
+ * current DS, as if it had been called from a quotation (ADR-053). */
+froth_error_t froth_execute_control(froth_vm_t* vm, froth_code_kind_t code);
@@ -7,7 +7,7 @@
 #include <stdint.h>
 
 #ifndef FROTH_FFI_MAX_TABLES
-#define FROTH_FFI_MAX_TABLES 8
+#define FROTH_FFI_MAX_TABLES 12
 #endif
 static const froth_ffi_entry_t *registered_tables[FROTH_FFI_MAX_TABLES];
 static froth_cell_u_t registered_table_count = 0;
@@ -90,6 +90,27 @@ froth_error_t froth_ffi_register(froth_vm_t *vm,
   return FROTH_OK;
 }
 
+/* Bind a table to the slots a boot image (ADR-071) already holds for it.
+ * The image was taken after froth_ffi_register ran on the same tables, so
+ * every name has its slot. A slot the image gives an impl was rebound by
+ * def after registration, and keeps it. */
+froth_error_t froth_ffi_bind(froth_vm_t *vm, const froth_ffi_entry_t *table) {
+  (void)vm;
+  if (registered_table_count >= FROTH_FFI_MAX_TABLES) {
+    return FROTH_ERROR_FFI_TABLE_FULL;
+  }
+  registered_tables[registered_table_count++] = table;
+  for (froth_cell_u_t i = 0; table[i].name != NULL; i++) {
+    froth_cell_u_t slot_index;
+    froth_cell_t impl;
+    FROTH_TRY(froth_slot_find_name(table[i].name, &slot_index));
+    if (froth_slot_get_impl(slot_index, &impl) == FROTH_OK)
+      continue;
+    FROTH_TRY(froth_slot_set_prim(slot_index, table[i].word));
+  }
+  return FROTH_OK;
+}
+
 /* Find FFI metadata for a primitive by function pointer. Walks all registered
  * tables. */
 const froth_ffi_entry_t *froth_ffi_find_entry(froth_native_word_t prim) {
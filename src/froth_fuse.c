@@ -0,0 +1,205 @@
+#include "froth_fuse.h"
+#include "froth_primitives.h"
+#include "froth_slot_table.h"
+#include <string.h>
+
+/* Stdlib shuffles that fused ops replace. These are ordinary quotation
+ * words, so they can be redefined; the impl captured at boot is the guard. */
+enum { W_DUP, W_OVER, W_SWAP, W_DROP, W_COUNT };
+
+typedef struct {
+  const char *name;
+  froth_cell_u_t slot_index;
+  froth_cell_t impl; /* 0 until the boot-time definition is seen */
+} fuse_word_t;
+
+static fuse_word_t fuse_words[W_COUNT] = {
+    [W_DUP] = {"dup", 0, 0},
+    [W_OVER] = {"over", 0, 0},
+    [W_SWAP] = {"swap", 0, 0},
+    [W_DROP] = {"drop", 0, 0},
+};
+
+/* True while slot still holds the definition captured for word w. */
+static inline bool word_intact(int w) {
+  return fuse_words[w].impl != 0 &&
+         slot_table[fuse_words[w].slot_index].impl == fuse_words[w].impl;
+}
+
+/* True if cell is a CALL to word w as captured at boot. */
+static bool is_word_call(froth_cell_t cell, int w) {
+  return FROTH_CELL_IS_CALL(cell) && word_intact(w) &&
+         (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell) == fuse_words[w].slot_index;
+}
+
+/* True if cell is a CALL to a slot bound to the given kernel primitive.
+ * Primitive slots cannot be redefined (ADR-031), so no runtime guard. */
+static bool is_prim_call(froth_cell_t cell, froth_native_word_t prim) {
+  return FROTH_CELL_IS_CALL(cell) &&
+         froth_slot_entry((froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell))->prim ==
+             prim;
+}
+
+void froth_fuse_note_def(froth_vm_t *vm, froth_cell_u_t slot_index,
+                         froth_cell_t impl) {
+  if (vm->boot_complete || !FROTH_CELL_IS_QUOTE(impl))
+    return;
+
+  const char *name;
+  if (froth_slot_get_name(slot_index, &name) != FROTH_OK)
+    return;
+
+  for (int w = 0; w < W_COUNT; w++) {
+    if (fuse_words[w].impl == 0 && strcmp(fuse_words[w].name, name) == 0) {
+      fuse_words[w].slot_index = slot_index;
+      fuse_words[w].impl = impl;
+      return;
+    }
+  }
+}
+
+/* Pack a fused cell. Fails if the first cell's payload loses bits. */
+static bool make_fused(froth_cell_t first, froth_fuse_op_t op,
+                       froth_cell_t *out) {
+  froth_cell_t arg = FROTH_CELL_STRIP_TAG(first);
+  froth_cell_t payload = (froth_cell_t)((froth_cell_u_t)arg << 4) |
+                         (froth_cell_t)((froth_cell_u_t)op << 1);
+  if ((payload >> 4) != arg)
+    return false;
+  return froth_make_cell(payload, FROTH_EXT, out) == FROTH_OK;
+}
+
+/* Match one idiom starting at body[i]. */
+static bool match_pair(froth_cell_t a, froth_cell_t b, froth_fuse_op_t *op) {
+  if (FROTH_CELL_IS_NUMBER(a)) {
+    if (is_prim_call(b, froth_prim_add)) {
+      *op = FROTH_FUSE_LIT_ADD;
+    } else if (is_prim_call(b, froth_prim_sub)) {
+      *op = FROTH_FUSE_LIT_SUB;
+    } else if (is_prim_call(b, froth_prim_compare_lt)) {
+      *op = FROTH_FUSE_LIT_LT;
+    } else if (is_prim_call(b, froth_prim_compare_gt)) {
+      *op = FROTH_FUSE_LIT_GT;
+    } else if (is_prim_call(b, froth_prim_compare_eq)) {
+      *op = FROTH_FUSE_LIT_EQ;
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  if (is_word_call(a, W_DUP) && is_prim_call(b, froth_prim_add)) {
+    *op = FROTH_FUSE_DUP_ADD;
+    return true;
+  }
+  if (is_word_call(a, W_OVER) && is_word_call(b, W_OVER)) {
+    *op = FROTH_FUSE_OVER_OVER;
+    return true;
+  }
+  if (is_word_call(a, W_SWAP) && is_word_call(b, W_DROP)) {
+    *op = FROTH_FUSE_SWAP_DROP;
+    return true;
+  }
+  return false;
+}
+
+void froth_fuse_quote(froth_vm_t *vm, froth_cell_t quote_cell) {
+  froth_cell_t *body =
+      froth_heap_cell_ptr(&vm->heap, FROTH_CELL_STRIP_TAG(quote_cell));
+  froth_cell_u_t length = (froth_cell_u_t)body[0];
+
+  for (froth_cell_u_t i = 1; i < length; i++) {
+    froth_fuse_op_t op;
+    froth_cell_t fused;
+    if (match_pair(body[i], body[i + 1], &op) &&
+        make_fused(body[i], op, &fused)) {
+      body[i] = fused;
+      i++; /* covered cell is never a fusion head */
+    }
+  }
+}
+
+froth_cell_t froth_fuse_original(froth_cell_t cell) {
+  if (!FROTH_CELL_IS_FUSED(cell))
+    return cell;
+
+  froth_cell_t arg = FROTH_FUSE_ARG(cell);
+  switch (FROTH_FUSE_OP(cell)) {
+  case FROTH_FUSE_DUP_ADD:
+  case FROTH_FUSE_OVER_OVER:
+  case FROTH_FUSE_SWAP_DROP:
+    return FROTH_CELL_PACK_TAG(arg, FROTH_CALL);
+  default:
+    return FROTH_CELL_PACK_TAG(arg, FROTH_NUMBER);
+  }
+}
+
+bool froth_fuse_run(froth_vm_t *vm, froth_cell_t cell) {
+  froth_stack_t *ds = &vm->ds;
+  froth_cell_u_t sp = ds->pointer;
+  froth_cell_t a;
+
+  switch (FROTH_FUSE_OP(cell)) {
+  case FROTH_FUSE_DUP_ADD:
+    if (!word_intact(W_DUP) || sp < 1 || !FROTH_CELL_IS_NUMBER(ds->data[sp - 1]))
+      return false;
+    a = FROTH_CELL_STRIP_TAG(ds->data[sp - 1]);
+    ds->data[sp - 1] = FROTH_CELL_PACK_TAG(
+        froth_wrap_payload((froth_cell_u_t)a + (froth_cell_u_t)a),
+        FROTH_NUMBER);
+    return true;
+
+  case FROTH_FUSE_OVER_OVER:
+    if (!word_intact(W_OVER) || sp < 2 || sp + 2 > ds->capacity)
+      return false;
+    ds->data[sp] = ds->data[sp - 2];
+    ds->data[sp + 1] = ds->data[sp - 1];
+    ds->pointer = sp + 2;
+    return true;
+
+  case FROTH_FUSE_SWAP_DROP:
+    if (!word_intact(W_SWAP) || !word_intact(W_DROP) || sp < 2)
+      return false;
+    ds->data[sp - 2] = ds->data[sp - 1];
+    ds->pointer = sp - 1;
+    return true;
+
+  default:
+    break;
+  }
+
+  /* Literal ops: ( a -- r ), a must be a number. */
+  if (sp < 1)
+    return false;
+  return froth_fuse_run_tos(cell, &ds->data[sp - 1]);
+}
+
+bool froth_fuse_run_tos(froth_cell_t cell, froth_cell_t *tos) {
+  froth_cell_t arg = FROTH_FUSE_ARG(cell);
+  froth_cell_t a;
+  froth_cell_t r;
+
+  if (FROTH_FUSE_OP(cell) < FROTH_FUSE_LIT_ADD || !FROTH_CELL_IS_NUMBER(*tos))
+    return false;
+  a = FROTH_CELL_STRIP_TAG(*tos);
+
+  switch (FROTH_FUSE_OP(cell)) {
+  case FROTH_FUSE_LIT_ADD:
+    r = froth_wrap_payload((froth_cell_u_t)a + (froth_cell_u_t)arg);
+    break;
+  case FROTH_FUSE_LIT_SUB:
+    r = froth_wrap_payload((froth_cell_u_t)a - (froth_cell_u_t)arg);
+    break;
+  case FROTH_FUSE_LIT_LT:
+    r = FROTH_BOOLIFY(a < arg);
+    break;
+  case FROTH_FUSE_LIT_GT:
+    r = FROTH_BOOLIFY(a > arg);
+    break;
+  default:
+    r = FROTH_BOOLIFY(a == arg);
+    break;
+  }
+  *tos = FROTH_CELL_PACK_TAG(r, FROTH_NUMBER);
+  return true;
+}
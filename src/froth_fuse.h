@@ -0,0 +1,75 @@
+#pragma once
+
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdbool.h>
+
+/* Superinstruction fusion (ADR-050).
+ *
+ * A peephole pass over quotation bodies rewrites hot two-cell idioms into a
+ * single FROTH_EXT cell. Only the first cell is replaced: the fused cell
+ * carries the first cell's payload, and the second cell stays in place. The
+ * executor skips the second cell when it runs the fused op, and falls back to
+ * the original first cell when the guard fails. Display, q@ and snapshots
+ * decode with froth_fuse_original(), so the body stays recoverable.
+ *
+ * Fused payload: [original first-cell payload | op:3 | 0]. */
+
+typedef enum {
+  FROTH_FUSE_DUP_ADD = 0,   /* dup +      ( a -- 2a )        */
+  FROTH_FUSE_OVER_OVER = 1, /* over over  ( a b -- a b a b ) */
+  FROTH_FUSE_SWAP_DROP = 2, /* swap drop  ( a b -- b )       */
+  FROTH_FUSE_LIT_ADD = 3,   /* N +        ( a -- a+N )       */
+  FROTH_FUSE_LIT_SUB = 4,   /* N -        ( a -- a-N )       */
+  FROTH_FUSE_LIT_LT = 5,    /* N <        ( a -- flag )      */
+  FROTH_FUSE_LIT_GT = 6,    /* N >        ( a -- flag )      */
+  FROTH_FUSE_LIT_EQ = 7,    /* N =        ( a -- flag )      */
+} froth_fuse_op_t;
+
+#define FROTH_FUSE_OP(cell) ((FROTH_CELL_STRIP_TAG((cell)) >> 1) & 0x7)
+#define FROTH_FUSE_ARG(cell) (FROTH_CELL_STRIP_TAG((cell)) >> 4)
+
+#ifdef FROTH_SUPERINSTRUCTIONS
+
+/* Record the boot-time definitions of the stdlib shuffles that fused ops
+ * stand in for. Called by def; only the first definition before
+ * boot_complete counts. */
+void froth_fuse_note_def(froth_vm_t *vm, froth_cell_u_t slot_index,
+                         froth_cell_t impl);
+
+/* Run the peephole pass over one quotation body (not its nested quotes,
+ * which are fused when they are built). Idempotent. */
+void froth_fuse_quote(froth_vm_t *vm, froth_cell_t quote_cell);
+
+/* Undo the fusion of a single cell. Non-fused cells are returned as-is. */
+froth_cell_t froth_fuse_original(froth_cell_t cell);
+
+/* Execute a fused cell. Returns false, with the VM untouched, when the guard
+ * or a stack precondition fails; the caller then runs the original cells so
+ * errors come from the real words. On success the caller skips the covered
+ * cell. */
+bool froth_fuse_run(froth_vm_t *vm, froth_cell_t cell);
+
+/* Execute a fused literal op ( a -- r ) on a top-of-stack cell held outside
+ * the DS (ADR-054). Returns false, with *tos untouched, for the other ops or
+ * when *tos is not a number. */
+bool froth_fuse_run_tos(froth_cell_t cell, froth_cell_t *tos);
+
+#else /* !FROTH_SUPERINSTRUCTIONS */
+
+static inline void froth_fuse_note_def(froth_vm_t *vm,
+                                       froth_cell_u_t slot_index,
+                                       froth_cell_t impl) {
+  (void)vm;
+  (void)slot_index;
+  (void)impl;
+}
+static inline void froth_fuse_quote(froth_vm_t *vm, froth_cell_t quote_cell) {
+  (void)vm;
+  (void)quote_cell;
+}
+static inline froth_cell_t froth_fuse_original(froth_cell_t cell) {
+  return cell;
+}
+
+#endif /* FROTH_SUPERINSTRUCTIONS */
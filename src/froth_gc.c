@@ -0,0 +1,365 @@
+#ifdef FROTH_GC
+
+#include "froth_gc.h"
+#include "froth_body.h"
+#include "froth_intern.h"
+#include "froth_jit.h"
+#include "froth_object.h"
+#include "froth_slot_table.h"
+#include "froth_stack.h"
+#include "froth_tbuf.h"
+#include <string.h>
+
+/* The collector works in granules of one cell. An object marks every
+ * granule it touches; compaction keeps each object's offset within its
+ * granule, so quotations stay cell-aligned. */
+#define GRANULE ((froth_cell_u_t)sizeof(froth_cell_t))
+#define GRANULES                                                               \
+  ((FROTH_HEAP_SIZE + sizeof(froth_cell_t) - 1) / sizeof(froth_cell_t))
+#define MAP_WORDS ((GRANULES + 31) / 32)
+
+static uint32_t live[MAP_WORDS];         /* granule holds live bytes */
+static uint32_t scanned[MAP_WORDS];      /* a live quotation starts here */
+static uint32_t holders[MAP_WORDS];      /* a live object starts here */
+static froth_cell_u_t before[MAP_WORDS]; /* live granules below each word */
+
+static froth_cell_u_t pending[FROTH_GC_MARK_STACK];
+static froth_cell_u_t pending_count;
+static bool pending_overflow;
+
+/* First collected byte, and the heap pointer when collection began. */
+static froth_cell_u_t region;
+static froth_cell_u_t top;
+
+static bool test_bit(const uint32_t *map, froth_cell_u_t g) {
+  return (map[g / 32] >> (g % 32)) & 1u;
+}
+
+static void set_bit(uint32_t *map, froth_cell_u_t g) {
+  map[g / 32] |= (uint32_t)1 << (g % 32);
+}
+
+static froth_cell_u_t count_bits(uint32_t word) {
+  froth_cell_u_t n = 0;
+  while (word) {
+    word &= word - 1;
+    n++;
+  }
+  return n;
+}
+
+static void mark_bytes(froth_cell_u_t start, froth_cell_u_t end) {
+  if (start < region)
+    start = region;
+  if (end > top)
+    end = top;
+  if (start >= end)
+    return;
+  for (froth_cell_u_t g = (start - region) / GRANULE;
+       g <= (end - 1 - region) / GRANULE; g++)
+    set_bit(live, g);
+}
+
+/* Heap offset of the object a cell refers to, or false if it does not
+ * refer to the collected region. */
+static bool overlay_ref(froth_cell_t cell, froth_cell_u_t *offset) {
+  froth_cell_u_t payload = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell);
+  switch (FROTH_CELL_GET_TAG(cell)) {
+  case FROTH_QUOTE:
+  case FROTH_PATTERN:
+    break;
+  case FROTH_BSTRING:
+    if (FROTH_BSTRING_IS_TRANSIENT(payload))
+      return false;
+    break;
+  case FROTH_EXT:
+    if (!FROTH_CELL_IS_OBJECT(cell))
+      return false;
+    payload = froth_object_offset(cell);
+    break;
+  default:
+    return false;
+  }
+  if (payload < region || payload >= top)
+    return false;
+  *offset = payload;
+  return true;
+}
+
+static void mark_cell(froth_vm_t *vm, froth_cell_t cell) {
+  froth_cell_u_t offset;
+  if (!overlay_ref(cell, &offset))
+    return;
+  /* A dangling object reference is left as it is, never walked. */
+  if (FROTH_CELL_IS_OBJECT(cell) && !froth_object_in_heap(&vm->heap, offset))
+    return;
+  mark_bytes(offset, offset + froth_heap_object_size(&vm->heap, cell));
+  uint32_t *map;
+  if (FROTH_CELL_IS_QUOTE(cell))
+    map = scanned;
+  else if (FROTH_CELL_IS_OBJECT(cell))
+    map = holders;
+  else
+    return;
+  froth_cell_u_t g = (offset - region) / GRANULE;
+  if (test_bit(map, g))
+    return;
+  set_bit(map, g);
+  if (pending_count < FROTH_GC_MARK_STACK)
+    pending[pending_count++] = offset;
+  else
+    pending_overflow = true;
+}
+
+static void scan_quote(froth_vm_t *vm, froth_cell_u_t offset) {
+  froth_cell_u_t length = froth_body_length(&vm->heap, offset);
+  for (froth_cell_u_t ip = 1; ip <= length;)
+    mark_cell(vm, froth_body_next(&vm->heap, offset, &ip));
+}
+
+static void scan_object(froth_vm_t *vm, froth_cell_u_t offset) {
+  if (!froth_object_in_heap(&vm->heap, offset))
+    return;
+  froth_cell_u_t count = froth_object_count(&vm->heap, offset);
+  const froth_cell_t *cells = froth_object_cells(&vm->heap, offset);
+  for (froth_cell_u_t i = 0; i < count; i++)
+    mark_cell(vm, cells[i]);
+}
+
+static void scan(froth_vm_t *vm, froth_cell_u_t offset) {
+  if (test_bit(holders, (offset - region) / GRANULE))
+    scan_object(vm, offset);
+  else
+    scan_quote(vm, offset);
+}
+
+static void drain(froth_vm_t *vm) {
+  while (pending_count > 0)
+    scan(vm, pending[--pending_count]);
+}
+
+/* Quotations and objects cut from the full mark stack were still marked;
+ * scanning every marked one again reaches their bodies. Repeat until
+ * nothing new overflows. */
+static void mark_overflowed(froth_vm_t *vm) {
+  froth_cell_u_t granules = (top - region + GRANULE - 1) / GRANULE;
+  while (pending_overflow) {
+    pending_overflow = false;
+    for (froth_cell_u_t g = 0; g < granules; g++) {
+      if (!test_bit(scanned, g) && !test_bit(holders, g))
+        continue;
+      scan(vm, region + g * GRANULE);
+      drain(vm);
+    }
+  }
+}
+
+static void mark_stack_cells(froth_vm_t *vm, const froth_stack_t *stack) {
+  for (froth_cell_u_t i = 0; i < stack->pointer; i++)
+    mark_cell(vm, stack->data[i]);
+}
+
+static void mark_roots(froth_vm_t *vm) {
+  froth_cell_u_t slots = froth_slot_count();
+  for (froth_cell_u_t i = 0; i < slots; i++) {
+    const froth_slot_t *slot = froth_slot_entry(i);
+    froth_cell_u_t name =
+        (froth_cell_u_t)((const uint8_t *)slot->name - vm->heap.data);
+    mark_bytes(name, name + strlen(slot->name) + 1);
+    mark_cell(vm, slot->impl);
+  }
+
+  mark_stack_cells(vm, &vm->ds);
+  mark_stack_cells(vm, &vm->rs);
+  mark_cell(vm, vm->thrown);
+
+  for (froth_cell_u_t i = 0; i < vm->cs.pointer; i++) {
+    const froth_cs_frame_t *frame = &vm->cs.data[i];
+    if (frame->kind == FROTH_CS_CATCH)
+      continue;
+    mark_cell(vm, FROTH_CELL_PACK_TAG(frame->quote_offset, FROTH_QUOTE));
+    if (frame->kind == FROTH_CS_WHILE_COND ||
+        frame->kind == FROTH_CS_WHILE_TEST)
+      mark_cell(vm, FROTH_CELL_PACK_TAG(frame->ip, FROTH_QUOTE));
+  }
+}
+
+/* Live granules below granule g. */
+static froth_cell_u_t live_below(froth_cell_u_t g) {
+  return before[g / 32] +
+         count_bits(live[g / 32] & (((uint32_t)1 << (g % 32)) - 1));
+}
+
+/* Where the byte at a marked offset ends up. */
+static froth_cell_u_t forward(froth_cell_u_t offset) {
+  if (offset < region || offset >= top)
+    return offset;
+  froth_cell_u_t rel = offset - region;
+  return region + live_below(rel / GRANULE) * GRANULE + rel % GRANULE;
+}
+
+/* A boundary rather than an object: an offset in dead space moves to the
+ * start of the live data that followed it. */
+static froth_cell_u_t forward_boundary(froth_cell_u_t offset,
+                                       froth_cell_u_t new_top) {
+  if (offset <= region)
+    return offset;
+  if (offset >= top)
+    return new_top;
+  froth_cell_u_t g = (offset - region) / GRANULE;
+  if (test_bit(live, g))
+    return forward(offset);
+  return region + live_below(g) * GRANULE;
+}
+
+static froth_cell_t forward_cell(froth_cell_t cell) {
+  froth_cell_u_t offset;
+  if (!overlay_ref(cell, &offset))
+    return cell;
+  if (FROTH_CELL_IS_OBJECT(cell))
+    return froth_object_cell(forward(offset));
+  return FROTH_CELL_PACK_TAG(forward(offset), FROTH_CELL_GET_TAG(cell));
+}
+
+static void forward_stack_cells(froth_stack_t *stack) {
+  for (froth_cell_u_t i = 0; i < stack->pointer; i++)
+    stack->data[i] = forward_cell(stack->data[i]);
+}
+
+static void forward_refs(froth_vm_t *vm, froth_cell_u_t granules) {
+  /* Quotation bodies, at their old addresses. References only move down,
+   * so a compact token still fits its width (ADR-062). */
+  for (froth_cell_u_t g = 0; g < granules; g++) {
+    if (!test_bit(scanned, g))
+      continue;
+    froth_cell_u_t offset = region + g * GRANULE;
+    froth_cell_u_t length = froth_body_length(&vm->heap, offset);
+    for (froth_cell_u_t ip = 1; ip <= length;) {
+      froth_cell_u_t at = ip;
+      froth_cell_t cell = froth_body_next(&vm->heap, offset, &ip);
+      froth_cell_t moved = forward_cell(cell);
+      if (moved != cell)
+        froth_body_store(&vm->heap, offset, at, moved);
+    }
+  }
+
+  /* Object bodies, likewise. */
+  for (froth_cell_u_t g = 0; g < granules; g++) {
+    froth_cell_u_t offset = region + g * GRANULE;
+    if (!test_bit(holders, g) || !froth_object_in_heap(&vm->heap, offset))
+      continue;
+    froth_cell_u_t count = froth_object_count(&vm->heap, offset);
+    froth_cell_t *cells = froth_object_cells(&vm->heap, offset);
+    for (froth_cell_u_t i = 0; i < count; i++)
+      cells[i] = forward_cell(cells[i]);
+  }
+
+  froth_cell_u_t slots = froth_slot_count();
+  for (froth_cell_u_t i = 0; i < slots; i++) {
+    const froth_slot_t *slot = froth_slot_entry(i);
+    froth_cell_u_t name =
+        (froth_cell_u_t)((const uint8_t *)slot->name - vm->heap.data);
+    froth_slot_move(i, forward_cell(slot->impl),
+                    (const char *)&vm->heap.data[forward(name)]);
+  }
+
+  forward_stack_cells(&vm->ds);
+  forward_stack_cells(&vm->rs);
+  vm->thrown = forward_cell(vm->thrown);
+
+  for (froth_cell_u_t i = 0; i < vm->cs.pointer; i++) {
+    froth_cs_frame_t *frame = &vm->cs.data[i];
+    if (frame->kind == FROTH_CS_CATCH)
+      continue;
+    frame->quote_offset = forward(frame->quote_offset);
+    if (frame->kind == FROTH_CS_WHILE_COND ||
+        frame->kind == FROTH_CS_WHILE_TEST)
+      frame->ip = forward(frame->ip);
+  }
+}
+
+void froth_gc_collect(froth_vm_t *vm) {
+  region = (vm->watermark_heap_offset + GRANULE - 1) / GRANULE * GRANULE;
+  top = vm->heap.pointer;
+  if (top <= region) {
+    vm->gc_trigger = region + (FROTH_HEAP_SIZE - region) / 2;
+    return;
+  }
+
+  froth_cell_u_t granules = (top - region + GRANULE - 1) / GRANULE;
+  froth_cell_u_t words = (granules + 31) / 32;
+  memset(live, 0, words * sizeof(live[0]));
+  memset(scanned, 0, words * sizeof(scanned[0]));
+  memset(holders, 0, words * sizeof(holders[0]));
+  pending_count = 0;
+  pending_overflow = false;
+
+  mark_roots(vm);
+  drain(vm);
+  mark_overflowed(vm);
+
+  froth_cell_u_t total = 0;
+  for (froth_cell_u_t w = 0; w < words; w++) {
+    before[w] = total;
+    total += count_bits(live[w]);
+  }
+  froth_cell_u_t new_top = region + total * GRANULE;
+  if (test_bit(live, granules - 1))
+    new_top -= granules * GRANULE - (top - region); /* last one is partial */
+
+  forward_refs(vm, granules);
+  for (froth_cell_u_t i = 0; i < vm->arenas.pointer; i++)
+    vm->arenas.data[i] = (froth_cell_t)forward_boundary(
+        (froth_cell_u_t)vm->arenas.data[i], new_top);
+
+  /* Slide each run of live granules down. */
+  froth_cell_u_t dst = region;
+  for (froth_cell_u_t g = 0; g < granules;) {
+    if (!test_bit(live, g)) {
+      g++;
+      continue;
+    }
+    froth_cell_u_t run = g;
+    while (run < granules && test_bit(live, run))
+      run++;
+    froth_cell_u_t src = region + g * GRANULE;
+    froth_cell_u_t len = (run - g) * GRANULE;
+    if (src + len > top)
+      len = top - src;
+    if (dst != src)
+      memmove(&vm->heap.data[dst], &vm->heap.data[src], len);
+    dst += len;
+    g = run;
+  }
+
+  vm->heap.pointer = new_top;
+  /* Interned overlay objects moved or died. */
+  froth_intern_forget_from(region);
+  vm->gc_trigger = new_top + (FROTH_HEAP_SIZE - new_top) / 2;
+  /* Compiled code embeds the old offsets of literals. */
+  froth_jit_forget();
+}
+
+bool froth_gc_poll(froth_vm_t *vm) {
+  if (!froth_gc_due(vm) || !vm->boot_complete)
+    return false;
+  froth_gc_collect(vm);
+  return true;
+}
+
+/* ---- gc ---- ( -- )
+ * Makes a collection due. It runs at the next safe point, after this
+ * primitive has returned. */
+static froth_error_t prim_gc(froth_vm_t *vm) {
+  vm->gc_trigger = 0;
+  return FROTH_OK;
+}
+
+FROTH_FFI(prim_gc, "gc", "( -- )", "Collect unreachable overlay heap");
+
+const froth_ffi_entry_t froth_gc_prims[] = {
+    FROTH_BIND(prim_gc),
+    {0},
+};
+
+#endif /* FROTH_GC */
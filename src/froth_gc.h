@@ -0,0 +1,60 @@
+#pragma once
+
+#include "froth_ffi.h"
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdbool.h>
+
+/* Mark-compact collector for the overlay heap (ADR-059).
+ *
+ * Everything allocated above watermark_heap_offset after boot is collected:
+ * quotations, patterns, permanent strings, objects (ADR-064) and overlay
+ * slot names. Roots are the slot table, DS, RS, vm->thrown and the
+ * quotations named by CS frames.
+ * Live bytes slide down in cell-sized granules, so every object keeps its
+ * alignment, and every reference is rewritten before anything moves.
+ *
+ * A collection runs only at a safe point where no C code holds a heap
+ * offset: between top-level tokens in the evaluator, and at frame entry in
+ * the outermost trampoline while no primitive is on the C stack
+ * (vm->gc_hold == 0). It is due once heap.pointer reaches vm->gc_trigger. */
+
+#ifdef FROTH_GC
+
+/* Quotations and objects waiting to be scanned. On overflow the mark phase
+ * rescans every marked one until nothing new is found. */
+#ifndef FROTH_GC_MARK_STACK
+#define FROTH_GC_MARK_STACK 32
+#endif
+
+/* Collect now if one is due and boot has finished. The caller has spilled
+ * any cached stack cell and reloads its heap pointers if this returns true. */
+bool froth_gc_poll(froth_vm_t *vm);
+
+/* Collect the overlay unconditionally. */
+void froth_gc_collect(froth_vm_t *vm);
+
+static inline bool froth_gc_due(const froth_vm_t *vm) {
+  return vm->heap.pointer >= vm->gc_trigger && vm->gc_hold == 0;
+}
+
+/* Native code that holds heap offsets across a nested run brackets it. */
+static inline void froth_gc_hold(froth_vm_t *vm) { vm->gc_hold++; }
+static inline void froth_gc_release(froth_vm_t *vm) { vm->gc_hold--; }
+
+extern const froth_ffi_entry_t froth_gc_prims[];
+
+#else /* !FROTH_GC */
+
+static inline bool froth_gc_due(const froth_vm_t *vm) {
+  (void)vm;
+  return false;
+}
+static inline bool froth_gc_poll(froth_vm_t *vm) {
+  (void)vm;
+  return false;
+}
+static inline void froth_gc_hold(froth_vm_t *vm) { (void)vm; }
+static inline void froth_gc_release(froth_vm_t *vm) { (void)vm; }
+
+#endif /* FROTH_GC */
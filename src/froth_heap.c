@@ -1,5 +1,8 @@
 #include "froth_heap.h"
+#include "froth_mem.h"
+#include "froth_object.h"
 #include <stddef.h>
+#include <string.h>
 
 froth_error_t froth_heap_allocate_bytes(froth_cell_u_t size, froth_heap_t* heap, froth_cell_u_t* assigned_heap_location) {
   if (heap->pointer + size > FROTH_HEAP_SIZE) {
@@ -8,6 +11,7 @@ froth_error_t froth_heap_allocate_bytes(froth_cell_u_t size, froth_heap_t* heap,
 
   froth_cell_u_t start_pointer = heap->pointer;
   heap->pointer += size;
+  froth_mem_note_heap(heap->pointer);
 
   *assigned_heap_location = start_pointer;
   return FROTH_OK;
@@ -21,8 +25,35 @@ froth_error_t froth_heap_allocate_cells(froth_cell_u_t count, froth_heap_t* heap
   }
 
   heap->pointer = aligned_pointer + count * sizeof(froth_cell_t);
+  froth_mem_note_heap(heap->pointer);
 
   *cells_out = (froth_cell_t*)&heap->data[aligned_pointer];
   if (byte_offset_out != NULL) { *byte_offset_out = aligned_pointer; }
   return FROTH_OK;
 }
+
+froth_cell_u_t froth_heap_object_size(const froth_heap_t* heap, froth_cell_t cell) {
+  froth_cell_u_t offset = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell);
+
+  switch (FROTH_CELL_GET_TAG(cell)) {
+  case FROTH_QUOTE: { // [length cell][body] (ADR-062)
+    froth_cell_t length;
+    memcpy(&length, &heap->data[offset], sizeof(length));
+#ifdef FROTH_COMPACT_QUOTES
+    return sizeof(froth_cell_t) + (froth_cell_u_t)length;
+#else
+    return (1 + (froth_cell_u_t)length) * sizeof(froth_cell_t);
+#endif
+  }
+  case FROTH_PATTERN: // [length byte][bytes...]
+    return 1 + (froth_cell_u_t)heap->data[offset];
+  case FROTH_EXT: // object: [header cell][count cells] (ADR-064)
+    return (1 + froth_object_count(heap, froth_object_offset(cell))) *
+           sizeof(froth_cell_t);
+  default: { // permanent BSTRING: [length cell][bytes...][\0] (ADR-023)
+    froth_cell_t length;
+    memcpy(&length, &heap->data[offset], sizeof(length));
+    return sizeof(froth_cell_t) + (froth_cell_u_t)length + 1;
+  }
+  }
+}
@@ -24,3 +24,7 @@ froth_error_t froth_heap_allocate_bytes(froth_cell_u_t size, froth_heap_t* froth
  * to the first cell. The byte offset (needed for QuoteRef payloads) is
  * written to `byte_offset_out` if non-NULL. */
 froth_error_t froth_heap_allocate_cells(froth_cell_u_t count, froth_heap_t* froth_heap, froth_cell_t** cells_out, froth_cell_u_t* byte_offset_out);
+
+/* Bytes taken by the object a QUOTE, PATTERN, permanent BSTRING or object
+ * cell refers to, from its length prefix or header. */
+froth_cell_u_t froth_heap_object_size(const froth_heap_t* heap, froth_cell_t cell);
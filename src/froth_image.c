@@ -0,0 +1,32 @@
+#include "froth_image.h"
+#include "froth_fuse.h"
+#include "froth_intern.h"
+#include "froth_mem.h"
+#include "froth_slot_table.h"
+#include <string.h>
+
+froth_error_t froth_image_load(froth_vm_t *vm) {
+  froth_cell_u_t slot_index;
+  froth_cell_t existing;
+
+  if (froth_boot_image_heap_size > FROTH_HEAP_SIZE)
+    return FROTH_ERROR_HEAP_OUT_OF_MEMORY;
+  memcpy(vm->heap.data, froth_boot_image_heap, froth_boot_image_heap_size);
+  vm->heap.pointer = froth_boot_image_heap_size;
+  froth_mem_note_heap(vm->heap.pointer);
+
+  for (froth_cell_u_t i = 0; i < froth_boot_image_slot_count; i++) {
+    const froth_image_slot_t *slot = &froth_boot_image_slots[i];
+    FROTH_TRY(froth_slot_create_named(
+        (const char *)&vm->heap.data[slot->name], &slot_index));
+    if (slot->impl == 0)
+      continue;
+    FROTH_TRY(froth_slot_set_impl(slot_index, slot->impl));
+    /* Fused bodies (ADR-050) check the stdlib shuffles they stand for. */
+    froth_fuse_note_def(vm, slot_index, slot->impl);
+  }
+
+  for (froth_cell_u_t i = 0; i < froth_boot_image_interned_count; i++)
+    froth_intern(vm, froth_boot_image_interned[i], &existing);
+  return FROTH_OK;
+}
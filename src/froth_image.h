@@ -0,0 +1,31 @@
+#pragma once
+
+#include "froth_types.h"
+#include "froth_vm.h"
+
+/* Boot image (ADR-071).
+ *
+ * The base image is the heap and slot table froth_boot leaves at the
+ * watermark, after the kernel and board tables are registered and the
+ * stdlib and board lib are evaluated. With FROTH_BOOT_IMAGE the build runs
+ * that boot on the host (src/froth_image_gen.c) and links the result as
+ * const data. The target copies it in and binds the primitive tables to
+ * the slots by name, because the host does not know their addresses. */
+
+/* One slot of the image, in slot order. */
+typedef struct {
+  froth_cell_u_t name; /* heap offset of the NUL-terminated name */
+  froth_cell_t impl;   /* 0 for a primitive or an undefined name */
+} froth_image_slot_t;
+
+/* Generated by froth_image_gen. */
+extern const uint8_t froth_boot_image_heap[];
+extern const froth_cell_u_t froth_boot_image_heap_size;
+extern const froth_image_slot_t froth_boot_image_slots[];
+extern const froth_cell_u_t froth_boot_image_slot_count;
+extern const froth_cell_t froth_boot_image_interned[];
+extern const froth_cell_u_t froth_boot_image_interned_count;
+
+/* Copy the image's heap and recreate its slots. Call on an empty VM,
+ * before the primitive tables are bound with froth_ffi_bind. */
+froth_error_t froth_image_load(froth_vm_t *vm);
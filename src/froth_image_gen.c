@@ -0,0 +1,93 @@
+/* Boot image generator (ADR-071). A host build of the kernel, with the same
+ * configuration and board as the target, that runs the base boot and
+ * writes the heap and slot table it leaves as C source. */
+
+#include "ffi.h"
+#include "froth_boot.h"
+#include "froth_image.h"
+#include "froth_intern.h"
+#include "froth_slot_table.h"
+#include "froth_vm.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static void fail(const char *message, const char *name) {
+  fprintf(stderr, "froth_image_gen: %s%s\n", message, name);
+  exit(1);
+}
+
+static void write_image(FILE *out) {
+  const froth_heap_t *heap = &froth_vm.heap;
+  froth_cell_u_t count = froth_slot_count();
+  froth_cell_u_t interned = 0;
+
+  fprintf(out, "/* Generated by froth_image_gen (ADR-071). Do not edit. */\n");
+  fprintf(out, "#include \"froth_image.h\"\n\n");
+  fprintf(out,
+          "#if FROTH_CELL_SIZE_BITS != %d || FROTH_HEAP_SIZE != %d || "
+          "FROTH_SLOT_TABLE_SIZE != %d\n",
+          FROTH_CELL_SIZE_BITS, FROTH_HEAP_SIZE, FROTH_SLOT_TABLE_SIZE);
+  fprintf(out, "#error \"boot image was generated for another "
+               "configuration\"\n#endif\n\n");
+
+  fprintf(out, "const uint8_t froth_boot_image_heap[] = {");
+  for (froth_cell_u_t i = 0; i < heap->pointer; i++)
+    fprintf(out, "%s0x%02x,", i % 16 == 0 ? "\n  " : " ", heap->data[i]);
+  fprintf(out, "\n};\n");
+  fprintf(out,
+          "const froth_cell_u_t froth_boot_image_heap_size = %" FROTH_CELL_U_FORMAT
+          ";\n\n",
+          heap->pointer);
+
+  fprintf(out, "const froth_image_slot_t froth_boot_image_slots[] = {\n");
+  for (froth_cell_u_t i = 0; i < count; i++) {
+    const froth_slot_t *slot = froth_slot_entry(i);
+    froth_cell_u_t found;
+    if (slot->prim != NULL &&
+        (froth_slot_find_name(slot->name, &found) != FROTH_OK || found != i))
+      fail("primitive name bound twice: ", slot->name);
+    fprintf(out, "  {%" FROTH_CELL_U_FORMAT ", %" FROTH_CELL_FORMAT "},\n",
+            (froth_cell_u_t)((const uint8_t *)slot->name - heap->data),
+            slot->impl);
+  }
+  fprintf(out, "};\n");
+  fprintf(out,
+          "const froth_cell_u_t froth_boot_image_slot_count = %" FROTH_CELL_U_FORMAT
+          ";\n\n",
+          count);
+
+  fprintf(out, "const froth_cell_t froth_boot_image_interned[] = {\n");
+#ifdef FROTH_INTERN
+  for (froth_cell_u_t i = 0; i < FROTH_INTERN_SIZE; i++) {
+    froth_cell_t cell = froth_intern_entry(i);
+    if (cell == 0)
+      continue;
+    fprintf(out, "  %" FROTH_CELL_FORMAT ",\n", cell);
+    interned++;
+  }
+#endif
+  if (interned == 0)
+    fprintf(out, "  0,\n");
+  fprintf(out, "};\n");
+  fprintf(out,
+          "const froth_cell_u_t froth_boot_image_interned_count = %" FROTH_CELL_U_FORMAT
+          ";\n",
+          interned);
+}
+
+int main(int argc, char **argv) {
+  if (argc != 2)
+    fail("usage: froth_image_gen OUTPUT.c", "");
+
+  froth_boot_base(froth_board_bindings);
+  if (froth_vm.ds.pointer != 0)
+    fail("the libraries left values on the data stack", "");
+
+  FILE *out = fopen(argv[1], "w");
+  if (out == NULL)
+    fail("cannot write ", argv[1]);
+  write_image(out);
+  if (fclose(out) != 0)
+    fail("cannot write ", argv[1]);
+  return 0;
+}
@@ -0,0 +1,57 @@
+#ifdef FROTH_INTERN
+
+#include "froth_intern.h"
+#include <string.h>
+
+/* Tagged QUOTE, PATTERN or BSTRING cells, 0 when empty. No such cell is 0:
+ * its tag is nonzero. */
+static froth_cell_t entries[FROTH_INTERN_SIZE];
+static uint32_t hashes[FROTH_INTERN_SIZE];
+
+/* FNV-1a over the tag and the object's bytes. */
+static uint32_t hash_object(const uint8_t *bytes, froth_cell_u_t size,
+                            froth_cell_t tag) {
+  uint32_t h = 2166136261u ^ (uint32_t)tag;
+  h *= 16777619u;
+  for (froth_cell_u_t i = 0; i < size; i++) {
+    h ^= bytes[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+bool froth_intern(froth_vm_t *vm, froth_cell_t cell, froth_cell_t *existing) {
+  froth_cell_u_t offset = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell);
+  froth_cell_u_t size = froth_heap_object_size(&vm->heap, cell);
+  const uint8_t *bytes = &vm->heap.data[offset];
+  uint32_t h = hash_object(bytes, size, FROTH_CELL_GET_TAG(cell));
+  froth_cell_u_t i = h % FROTH_INTERN_SIZE;
+
+  froth_cell_t other = entries[i];
+  if (other != 0 && hashes[i] == h &&
+      FROTH_CELL_GET_TAG(other) == FROTH_CELL_GET_TAG(cell)) {
+    froth_cell_u_t other_offset = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(other);
+    if (other_offset != offset &&
+        froth_heap_object_size(&vm->heap, other) == size &&
+        memcmp(&vm->heap.data[other_offset], bytes, size) == 0) {
+      *existing = other;
+      return true;
+    }
+  }
+
+  entries[i] = cell;
+  hashes[i] = h;
+  return false;
+}
+
+void froth_intern_forget_from(froth_cell_u_t offset) {
+  for (froth_cell_u_t i = 0; i < FROTH_INTERN_SIZE; i++) {
+    if (entries[i] != 0 &&
+        (froth_cell_u_t)FROTH_CELL_STRIP_TAG(entries[i]) >= offset)
+      entries[i] = 0;
+  }
+}
+
+froth_cell_t froth_intern_entry(froth_cell_u_t i) { return entries[i]; }
+
+#endif /* FROTH_INTERN */
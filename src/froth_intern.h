@@ -0,0 +1,49 @@
+#pragma once
+
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdbool.h>
+
+/* Hash-consing of evaluator-built objects (ADR-061).
+ *
+ * Quotations, patterns and string literals are immutable once built, so
+ * equal ones can share one heap copy. The evaluator builds each object as
+ * before, then asks the intern table for an equal one; if there is one, it
+ * uses that and frees the copy.
+ *
+ * The table is a direct-mapped cache of FROTH_INTERN_SIZE cells keyed by a
+ * hash of the object's bytes. A collision evicts the older entry, which
+ * only loses sharing. Equality is always checked byte for byte. Entries at
+ * or above an offset are dropped whenever the heap below them is freed. */
+
+#ifdef FROTH_INTERN
+
+#ifndef FROTH_INTERN_SIZE
+#define FROTH_INTERN_SIZE 64
+#endif
+
+/* cell was just built. If an equal object is interned, write it to
+ * existing and return true. Otherwise record cell and return false. */
+bool froth_intern(froth_vm_t *vm, froth_cell_t cell, froth_cell_t *existing);
+
+/* The heap from offset up is being freed or moved. */
+void froth_intern_forget_from(froth_cell_u_t offset);
+
+/* Entry i of the table, or 0 if it is empty. A boot image (ADR-071) keeps
+ * the entries, and loading it interns them again. */
+froth_cell_t froth_intern_entry(froth_cell_u_t i);
+
+#else /* !FROTH_INTERN */
+
+static inline bool froth_intern(froth_vm_t *vm, froth_cell_t cell,
+                                froth_cell_t *existing) {
+  (void)vm;
+  (void)cell;
+  (void)existing;
+  return false;
+}
+static inline void froth_intern_forget_from(froth_cell_u_t offset) {
+  (void)offset;
+}
+
+#endif /* FROTH_INTERN */
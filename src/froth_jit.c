@@ -0,0 +1,444 @@
+#include "froth_jit.h"
+#include "froth_fuse.h"
+#include "froth_verify.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#if !defined(__x86_64__)
+#error "FROTH_JIT emits x86-64 code"
+#endif
+
+#if FROTH_CELL_SIZE_BITS != 32 && FROTH_CELL_SIZE_BITS != 64
+#error "FROTH_JIT supports 32- and 64-bit cells"
+#endif
+
+/*
+ * Code layout of one body:
+ *
+ *   prologue   push rbx; push r12; sub rsp, 8
+ *              mov rbx, rdi (vm); mov r12, rsi (&frame->ip); jmp rdx
+ *   epilogue   add rsp, 8; pop r12; pop rbx; ret
+ *   cell 1..n  one template each, entered through resume[ip]
+ *
+ * The function returns a froth_error_t in eax and leaves the next cell for
+ * the interpreter in *ip. Every exit is "store ip, set eax, jmp epilogue".
+ */
+typedef froth_error_t (*jit_code_t)(froth_vm_t *vm, froth_cell_u_t *ip,
+                                    const uint8_t *entry);
+
+typedef struct {
+  froth_cell_u_t quote_offset;
+  uint32_t epoch;
+  uint32_t code;                              /* arena offset of prologue */
+  uint32_t resume[FROTH_JIT_MAX_CELLS + 1]; /* arena offset of cell ip */
+} jit_body_t;
+
+uint16_t froth_jit_slot_body[FROTH_SLOT_TABLE_SIZE];
+uint16_t froth_jit_slot_calls[FROTH_SLOT_TABLE_SIZE];
+
+/* Compiled code compares against this after each top-level primitive. */
+static volatile uint32_t jit_epoch = 1;
+
+static jit_body_t bodies[FROTH_JIT_MAX_BODIES];
+static froth_cell_u_t body_count = 0;
+
+static uint8_t *arena = NULL;
+static size_t arena_used = 0;
+static bool arena_failed = false;
+
+/* Compiled frames on the C stack. The arena is only made writable, or
+ * discarded, when there are none. */
+static froth_cell_u_t running = 0;
+
+/* --- Emitter --- */
+
+static size_t emit_pos;
+static bool emit_overflow;
+
+static void emit1(uint8_t b) {
+  if (emit_pos >= FROTH_JIT_CODE_SIZE) {
+    emit_overflow = true;
+    return;
+  }
+  arena[emit_pos++] = b;
+}
+
+static void emit_bytes(const uint8_t *bytes, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    emit1(bytes[i]);
+}
+
+static void emit32(uint32_t v) {
+  for (int i = 0; i < 4; i++)
+    emit1((uint8_t)(v >> (8 * i)));
+}
+
+static void emit64(uint64_t v) {
+  for (int i = 0; i < 8; i++)
+    emit1((uint8_t)(v >> (8 * i)));
+}
+
+/* REX.W for operations on cell-width fields. */
+static void emit_cell_rex(void) {
+#if FROTH_CELL_SIZE_BITS == 64
+  emit1(0x48);
+#endif
+}
+
+/* Forward jcc rel8 / jmp rel8 and its patch. */
+static size_t emit_jump8(uint8_t opcode) {
+  emit1(opcode);
+  emit1(0);
+  return emit_pos;
+}
+
+static void patch_jump8(size_t after) {
+  if (emit_overflow)
+    return;
+  arena[after - 1] = (uint8_t)(emit_pos - after);
+}
+
+#define VM_FIELD(field) ((uint32_t)offsetof(froth_vm_t, field))
+
+/* mov eax/rax, [rbx + off] */
+static void emit_load_cell(uint32_t off) {
+  emit_cell_rex();
+  emit1(0x8B);
+  emit1(0x83);
+  emit32(off);
+}
+
+/* cmp eax/rax, [rbx + off] */
+static void emit_cmp_cell(uint32_t off) {
+  emit_cell_rex();
+  emit1(0x3B);
+  emit1(0x83);
+  emit32(off);
+}
+
+/* mov [r12], ip */
+static void emit_set_ip(froth_cell_u_t ip) {
+#if FROTH_CELL_SIZE_BITS == 64
+  emit1(0x49);
+#else
+  emit1(0x41);
+#endif
+  emit_bytes((const uint8_t[]){0xC7, 0x04, 0x24}, 3);
+  emit32((uint32_t)ip);
+}
+
+/* Leave with *ip = ip and eax = err. */
+static void emit_exit(size_t epilogue, froth_cell_u_t ip, froth_error_t err) {
+  emit_set_ip(ip);
+  if (err == FROTH_OK) {
+    emit_bytes((const uint8_t[]){0x31, 0xC0}, 2); /* xor eax, eax */
+  } else {
+    emit1(0xB8); /* mov eax, imm32 */
+    emit32((uint32_t)err);
+  }
+  emit1(0xE9); /* jmp rel32 */
+  emit32((uint32_t)(epilogue - (emit_pos + 4)));
+}
+
+/* vm->last_error_slot = slot_index, as op_call does. */
+static void emit_error_slot(froth_cell_u_t slot_index) {
+  emit_cell_rex();
+  emit1(0xC7);
+  emit1(0x83);
+  emit32(VM_FIELD(last_error_slot));
+  emit32((uint32_t)slot_index);
+}
+
+/* Template: push a literal cell, with op_literal's overflow check. */
+static void emit_push(size_t epilogue, froth_cell_t cell, froth_cell_u_t ip) {
+  emit_load_cell(VM_FIELD(ds.pointer));
+  emit_cmp_cell(VM_FIELD(ds.capacity));
+  size_t ok = emit_jump8(0x72); /* jb */
+  emit_exit(epilogue, ip, FROTH_ERROR_STACK_OVERFLOW);
+  patch_jump8(ok);
+  /* mov rcx, [rbx + ds.data] */
+  emit_bytes((const uint8_t[]){0x48, 0x8B, 0x8B}, 3);
+  emit32(VM_FIELD(ds.data));
+#if FROTH_CELL_SIZE_BITS == 64
+  if (cell >= INT32_MIN && cell <= INT32_MAX) {
+    /* mov qword [rcx + rax*8], imm32 */
+    emit_bytes((const uint8_t[]){0x48, 0xC7, 0x04, 0xC1}, 4);
+    emit32((uint32_t)cell);
+  } else {
+    emit_bytes((const uint8_t[]){0x48, 0xBA}, 2); /* mov rdx, imm64 */
+    emit64((uint64_t)cell);
+    /* mov [rcx + rax*8], rdx */
+    emit_bytes((const uint8_t[]){0x48, 0x89, 0x14, 0xC1}, 4);
+  }
+#else
+  /* mov dword [rcx + rax*4], imm32 */
+  emit_bytes((const uint8_t[]){0xC7, 0x04, 0x81}, 3);
+  emit32((uint32_t)cell);
+#endif
+  emit_cell_rex();
+  emit_bytes((const uint8_t[]){0xFF, 0xC0}, 2); /* inc eax/rax */
+  emit_cell_rex();
+  emit1(0x89); /* mov [rbx + ds.pointer], eax/rax */
+  emit1(0x83);
+  emit32(VM_FIELD(ds.pointer));
+}
+
+/* Template: call a primitive, leaving on error. */
+static void emit_call_prim(size_t epilogue, froth_cell_u_t slot_index,
+                           froth_native_word_t prim, froth_cell_u_t ip) {
+  emit_error_slot(slot_index);
+  emit_bytes((const uint8_t[]){0x48, 0x89, 0xDF}, 3); /* mov rdi, rbx */
+  emit_bytes((const uint8_t[]){0x48, 0xB8}, 2);       /* mov rax, imm64 */
+  emit64((uint64_t)(uintptr_t)prim);
+  emit_bytes((const uint8_t[]){0xFF, 0xD0}, 2); /* call rax */
+  emit_bytes((const uint8_t[]){0x85, 0xC0}, 2); /* test eax, eax */
+  size_t ok = emit_jump8(0x74);                 /* jz */
+  emit_set_ip(ip);
+  emit1(0xE9);
+  emit32((uint32_t)(epilogue - (emit_pos + 4)));
+  patch_jump8(ok);
+}
+
+/* Leave for the interpreter at ip if a primitive just rebound a word. */
+static void emit_epoch_check(size_t epilogue, froth_cell_u_t ip) {
+  emit_bytes((const uint8_t[]){0x48, 0xB8}, 2); /* mov rax, &jit_epoch */
+  emit64((uint64_t)(uintptr_t)&jit_epoch);
+  emit_bytes((const uint8_t[]){0x81, 0x38}, 2); /* cmp dword [rax], imm32 */
+  emit32(jit_epoch);
+  size_t ok = emit_jump8(0x74); /* je */
+  emit_exit(epilogue, ip, FROTH_OK);
+  patch_jump8(ok);
+}
+
+/* Leave for the interpreter at ip unless the CS has room for every frame
+ * an inlined call tree would have pushed. */
+static void emit_cs_check(size_t epilogue, froth_cell_u_t ip) {
+  emit_load_cell(VM_FIELD(cs.pointer));
+  emit_cell_rex();
+  emit_bytes((const uint8_t[]){0x83, 0xC0, FROTH_JIT_INLINE_DEPTH}, 3);
+  emit_cmp_cell(VM_FIELD(cs.capacity));
+  size_t ok = emit_jump8(0x76); /* jbe */
+  emit_exit(epilogue, ip, FROTH_OK);
+  patch_jump8(ok);
+}
+
+/* --- Translation --- */
+
+static bool is_literal(froth_cell_t cell) {
+  return FROTH_CELL_GET_TAG(cell) <= FROTH_BSTRING;
+}
+
+/* True if the quotation word in slot can be inlined: verified, so it cannot
+ * rebind words or recurse (ADR-055). */
+static bool can_inline(froth_vm_t *vm, froth_cell_u_t slot_index) {
+#ifdef FROTH_STACK_VERIFY
+  froth_verify_slot(vm, slot_index);
+  return froth_slot_entry(slot_index)->verify == FROTH_VERIFY_OK;
+#else
+  (void)vm;
+  (void)slot_index;
+  return false;
+#endif
+}
+
+/* Inline the body of a verified callee. Errors leave with *ip = err_ip,
+ * the cell after the top-level call. Fails, with code already emitted, on a
+ * cell that would need a CS frame of its own. */
+static bool emit_inline(froth_vm_t *vm, size_t epilogue,
+                        froth_cell_u_t slot_index, froth_cell_u_t err_ip,
+                        int depth) {
+  const froth_slot_t *slot = froth_slot_entry(slot_index);
+  froth_cell_t *base =
+      froth_heap_cell_ptr(&vm->heap, FROTH_CELL_STRIP_TAG(slot->impl));
+  froth_cell_u_t length = (froth_cell_u_t)base[0];
+
+  emit_error_slot(slot_index);
+  for (froth_cell_u_t i = 1; i <= length; i++) {
+    froth_cell_t cell = froth_fuse_original(base[i]);
+    if (is_literal(cell)) {
+      emit_push(epilogue, cell, err_ip);
+      continue;
+    }
+    if (!FROTH_CELL_IS_CALL(cell))
+      return false;
+
+    froth_cell_u_t callee = FROTH_CELL_STRIP_TAG(cell);
+    const froth_slot_t *target = froth_slot_entry(callee);
+    switch (target->code) {
+    case FROTH_CODE_PRIM:
+    case FROTH_CODE_BINOP:
+      emit_call_prim(epilogue, callee, target->prim, err_ip);
+      break;
+    case FROTH_CODE_VALUE:
+      emit_error_slot(callee);
+      emit_push(epilogue, target->impl, err_ip);
+      break;
+    case FROTH_CODE_QUOTE:
+      if (depth >= FROTH_JIT_INLINE_DEPTH || !can_inline(vm, callee) ||
+          !emit_inline(vm, epilogue, callee, err_ip, depth + 1))
+        return false;
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Translate one top-level cell. Anything without a template leaves for the
+ * interpreter, which runs the cell and re-enters the code at the next one
+ * when the frame resumes. */
+static void emit_cell(froth_vm_t *vm, size_t epilogue, froth_cell_t cell,
+                      froth_cell_u_t ip) {
+  cell = froth_fuse_original(cell);
+  if (is_literal(cell)) {
+    emit_push(epilogue, cell, ip + 1);
+    return;
+  }
+  if (!FROTH_CELL_IS_CALL(cell)) {
+    emit_exit(epilogue, ip, FROTH_OK);
+    return;
+  }
+
+  froth_cell_u_t slot_index = FROTH_CELL_STRIP_TAG(cell);
+  const froth_slot_t *slot = froth_slot_entry(slot_index);
+  switch (slot->code) {
+  case FROTH_CODE_PRIM:
+  case FROTH_CODE_BINOP:
+    emit_call_prim(epilogue, slot_index, slot->prim, ip + 1);
+    emit_epoch_check(epilogue, ip + 1);
+    return;
+  case FROTH_CODE_VALUE:
+    emit_error_slot(slot_index);
+    emit_push(epilogue, slot->impl, ip + 1);
+    return;
+  case FROTH_CODE_QUOTE:
+    if (can_inline(vm, slot_index)) {
+      size_t start = emit_pos;
+      emit_cs_check(epilogue, ip);
+      if (emit_inline(vm, epilogue, slot_index, ip + 1, 1))
+        return;
+      emit_pos = start;
+    }
+    break;
+  default:
+    break;
+  }
+  /* Call-quote: the trampoline pushes the callee's frame. */
+  emit_exit(epilogue, ip, FROTH_OK);
+}
+
+static void jit_reset(void) {
+  body_count = 0;
+  arena_used = 0;
+  froth_jit_forget();
+}
+
+static bool arena_writable(bool writable) {
+  return mprotect(arena, FROTH_JIT_CODE_SIZE,
+                  writable ? PROT_READ | PROT_WRITE
+                           : PROT_READ | PROT_EXEC) == 0;
+}
+
+froth_cell_u_t froth_jit_compile_slot(froth_vm_t *vm,
+                                      froth_cell_u_t slot_index) {
+  froth_jit_slot_calls[slot_index] = 0;
+  const froth_slot_t *slot = froth_slot_entry(slot_index);
+  if (running != 0 || arena_failed || slot->code != FROTH_CODE_QUOTE)
+    return 0;
+
+  froth_cell_u_t offset = FROTH_CELL_STRIP_TAG(slot->impl);
+  froth_cell_t *base = froth_heap_cell_ptr(&vm->heap, offset);
+  froth_cell_u_t length = (froth_cell_u_t)base[0];
+  if (length == 0 || length > FROTH_JIT_MAX_CELLS)
+    return 0;
+
+  if (arena == NULL) {
+    void *map = mmap(NULL, FROTH_JIT_CODE_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED) {
+      arena_failed = true;
+      return 0;
+    }
+    arena = map;
+  } else if (!arena_writable(true)) {
+    arena_failed = true;
+    return 0;
+  }
+  if (body_count >= FROTH_JIT_MAX_BODIES)
+    jit_reset();
+
+  jit_body_t *body = &bodies[body_count];
+  emit_pos = arena_used;
+  emit_overflow = false;
+
+  body->code = (uint32_t)emit_pos;
+  static const uint8_t prologue[] = {
+      0x53,                   /* push rbx */
+      0x41, 0x54,             /* push r12 */
+      0x48, 0x83, 0xEC, 0x08, /* sub rsp, 8 */
+      0x48, 0x89, 0xFB,       /* mov rbx, rdi */
+      0x49, 0x89, 0xF4,       /* mov r12, rsi */
+      0xFF, 0xE2,             /* jmp rdx */
+  };
+  static const uint8_t epilogue[] = {
+      0x48, 0x83, 0xC4, 0x08, /* add rsp, 8 */
+      0x41, 0x5C,             /* pop r12 */
+      0x5B,                   /* pop rbx */
+      0xC3,                   /* ret */
+  };
+  emit_bytes(prologue, sizeof prologue);
+  size_t epilogue_pos = emit_pos;
+  emit_bytes(epilogue, sizeof epilogue);
+
+  for (froth_cell_u_t ip = 1; ip <= length; ip++) {
+    body->resume[ip] = (uint32_t)emit_pos;
+    emit_cell(vm, epilogue_pos, base[ip], ip);
+  }
+  /* Falling off the end leaves the frame with ip past its last cell. */
+  emit_exit(epilogue_pos, length + 1, FROTH_OK);
+
+  if (emit_overflow) {
+    /* Full: start again with an empty arena on a later call. */
+    jit_reset();
+    arena_writable(false);
+    return 0;
+  }
+  arena_used = emit_pos;
+  if (!arena_writable(false)) {
+    arena_failed = true;
+    return 0;
+  }
+
+  body->quote_offset = offset;
+  body->epoch = jit_epoch;
+  body_count++;
+  froth_jit_slot_body[slot_index] = (uint16_t)body_count;
+  return body_count;
+}
+
+froth_error_t froth_jit_run(froth_vm_t *vm, froth_cs_frame_t *frame) {
+  jit_body_t *body = &bodies[frame->ds_depth - 1];
+  if (frame->ds_depth > body_count || body->epoch != jit_epoch ||
+      body->quote_offset != frame->quote_offset) {
+    /* Rebound or discarded since the frame was entered. */
+    frame->ds_depth = 0;
+    return FROTH_OK;
+  }
+
+  jit_code_t code;
+  uint8_t *prologue = arena + body->code;
+  memcpy(&code, &prologue, sizeof code);
+
+  running++;
+  froth_error_t err = code(vm, &frame->ip, arena + body->resume[frame->ip]);
+  running--;
+  return err;
+}
+
+void froth_jit_forget(void) {
+  jit_epoch++;
+  memset(froth_jit_slot_body, 0, sizeof froth_jit_slot_body);
+}
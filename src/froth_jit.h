@@ -0,0 +1,80 @@
+#pragma once
+
+#include "froth_slot_table.h"
+#include "froth_stack.h"
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdint.h>
+
+/* Template JIT for POSIX x86-64 builds (ADR-057).
+ *
+ * A quotation word called FROTH_JIT_THRESHOLD times has its body translated
+ * to machine code by stitching fixed templates: push a literal, call a
+ * primitive, and leave for the trampoline at a call it does not compile.
+ * The trampoline runs the compiled code when it enters or resumes the
+ * word's CS frame, and interprets from wherever the code stops, so tail
+ * calls, while, catch and CS accounting are unchanged. Verified callees
+ * (ADR-055) are inlined.
+ *
+ * Compiled code binds words when it is built. Any rebinding calls
+ * froth_jit_forget(), which advances the JIT's epoch. Each body records the
+ * epoch it was compiled in: froth_jit_run drops a body whose epoch is stale
+ * at its next entry, and code already running compares the epoch after each
+ * primitive and falls back to the interpreter. */
+
+#ifdef FROTH_JIT
+
+/* Calls of a word before its body is compiled. */
+#ifndef FROTH_JIT_THRESHOLD
+#define FROTH_JIT_THRESHOLD 64
+#endif
+/* Executable code arena, in bytes. When full it is discarded whole. */
+#ifndef FROTH_JIT_CODE_SIZE
+#define FROTH_JIT_CODE_SIZE (256 * 1024)
+#endif
+/* Compiled bodies live at the same time. */
+#ifndef FROTH_JIT_MAX_BODIES
+#define FROTH_JIT_MAX_BODIES 128
+#endif
+/* Longest body that is compiled, in cells. */
+#ifndef FROTH_JIT_MAX_CELLS
+#define FROTH_JIT_MAX_CELLS 256
+#endif
+/* Nesting of inlined verified callees. */
+#ifndef FROTH_JIT_INLINE_DEPTH
+#define FROTH_JIT_INLINE_DEPTH 4
+#endif
+
+/* Per slot: compiled body id + 1, or 0. Cleared by froth_jit_forget. */
+extern uint16_t froth_jit_slot_body[FROTH_SLOT_TABLE_SIZE];
+extern uint16_t froth_jit_slot_calls[FROTH_SLOT_TABLE_SIZE];
+
+/* Compile the body of the quotation word in slot_index. Returns its body
+ * id + 1, or 0 if it cannot be compiled now. */
+froth_cell_u_t froth_jit_compile_slot(froth_vm_t *vm,
+                                      froth_cell_u_t slot_index);
+
+/* Body to record in the CS frame of a call to slot_index: counts the call
+ * and compiles the word when it becomes hot. */
+static inline froth_cell_u_t froth_jit_body(froth_vm_t *vm,
+                                            froth_cell_u_t slot_index) {
+  if (froth_jit_slot_body[slot_index] != 0)
+    return froth_jit_slot_body[slot_index];
+  if (++froth_jit_slot_calls[slot_index] < FROTH_JIT_THRESHOLD)
+    return 0;
+  return froth_jit_compile_slot(vm, slot_index);
+}
+
+/* Run frame's compiled body from frame->ip. On return frame->ip is the
+ * first cell left to the interpreter. A stale body is detached from the
+ * frame without running. */
+froth_error_t froth_jit_run(froth_vm_t *vm, froth_cs_frame_t *frame);
+
+/* A binding or a quotation body changed: drop every compiled body. */
+void froth_jit_forget(void);
+
+#else /* !FROTH_JIT */
+
+static inline void froth_jit_forget(void) {}
+
+#endif /* FROTH_JIT */
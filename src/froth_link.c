@@ -1,7 +1,10 @@
 #include "froth_link.h"
 #include "froth_console.h"
 #include "froth_evaluator.h"
+#include "froth_mem.h"
+#include "froth_object.h"
 #include "froth_primitives.h"
+#include "froth_profile.h"
 #include "froth_slot_table.h"
 #include "froth_transport.h"
 #include "froth_vm.h"
@@ -92,6 +95,15 @@ static int format_stack(froth_vm_t *vm, char *buf, int cap) {
     case FROTH_BSTRING:
       wrote = snprintf(buf + pos, cap - pos, "<str>");
       break;
+    case FROTH_EXT:
+      if (FROTH_CELL_IS_OBJECT(cell)) {
+        const char *kind = froth_object_kind_name(
+            froth_object_kind(&vm->heap, froth_object_offset(cell)));
+        wrote = snprintf(buf + pos, cap - pos, "<%s>", kind);
+        break;
+      }
+      wrote = snprintf(buf + pos, cap - pos, "<%d>", (int)tag);
+      break;
     default:
       wrote = snprintf(buf + pos, cap - pos, "<%d>", (int)tag);
       break;
@@ -131,7 +143,8 @@ froth_error_t froth_link_send_hello_res(froth_vm_t *vm, uint64_t session_id,
   FROTH_TRY(pw_u8(&pw, 0)); /* flags (reserved) */
   FROTH_TRY(pw_str(&pw, FROTH_VERSION));
   FROTH_TRY(pw_str(&pw, FROTH_BOARD_NAME));
-  FROTH_TRY(pw_u8(&pw, 0)); /* capability_count */
+  FROTH_TRY(pw_u8(&pw, 1)); /* capability_count */
+  FROTH_TRY(pw_u8(&pw, FROTH_LINK_CAP_EVAL_STREAM));
 
   FROTH_TRY(froth_console_flush_output());
   return froth_link_send_frame(session_id, FROTH_LINK_HELLO_RES, seq, resp_buf,
@@ -145,38 +158,59 @@ static froth_error_t handle_hello(froth_vm_t *vm,
 
 /* ── EVAL ────────────────────────────────────────────────────────── */
 
+/* One source can span several EVAL_REQs (ADR-072). Each is fed to
+ * eval_stream as it arrives; one without FROTH_LINK_EVAL_MORE ends it. */
+static froth_eval_stream_t eval_stream;
+static char eval_pending[FROTH_EVAL_PENDING_SIZE];
+static bool eval_open = false;
+static froth_cell_u_t eval_ds_snap, eval_rs_snap;
+
+void froth_link_eval_abort(froth_vm_t *vm) {
+  if (!eval_open)
+    return;
+  froth_eval_stream_abort(&eval_stream, vm);
+  vm->ds.pointer = eval_ds_snap;
+  vm->rs.pointer = eval_rs_snap;
+  eval_open = false;
+}
+
 static froth_error_t handle_eval(froth_vm_t *vm,
                                  const froth_link_header_t *header,
                                  const uint8_t *payload) {
   if (header->payload_length < 3)
     return FROTH_ERROR_LINK_TOO_LARGE;
 
-  /* uint8_t flags = payload[0]; */
+  uint8_t flags = payload[0];
   uint16_t source_len = (uint16_t)payload[1] | ((uint16_t)payload[2] << 8);
 
   if ((uint16_t)(3 + source_len) != header->payload_length)
     return FROTH_ERROR_LINK_TOO_LARGE;
 
-  /* Copy source into a null-terminated buffer on the stack */
-  char source[FROTH_LINK_MAX_PAYLOAD];
-  if (source_len >= sizeof(source))
-    return FROTH_ERROR_LINK_TOO_LARGE;
-  memcpy(source, payload + 3, source_len);
-  source[source_len] = '\0';
-
-  /* Evaluate */
-  froth_cell_u_t ds_snap = vm->ds.pointer;
-  froth_cell_u_t rs_snap = vm->rs.pointer;
-  vm->last_error_slot = -1;
+  /* Evaluate straight from the payload */
+  if (!eval_open) {
+    froth_eval_stream_init(&eval_stream, eval_pending, sizeof(eval_pending));
+    eval_ds_snap = vm->ds.pointer;
+    eval_rs_snap = vm->rs.pointer;
+    vm->last_error_slot = -1;
+    eval_open = true;
+  }
 
-  froth_error_t eval_err = froth_evaluate_input(source, vm);
+  bool more = (flags & FROTH_LINK_EVAL_MORE) != 0;
+  froth_error_t eval_err = froth_eval_stream_feed(
+      &eval_stream, (const char *)payload + 3, source_len, vm);
+  if (eval_err == FROTH_OK && !more)
+    eval_err = froth_eval_stream_end(&eval_stream, vm);
+  if (eval_err != FROTH_OK || !more)
+    eval_open = false;
 
   /* Build EVAL_RES */
   payload_writer_t pw = {resp_buf, sizeof(resp_buf), 0};
 
   if (eval_err == FROTH_OK) {
-    char stack_buf[128];
-    format_stack(vm, stack_buf, sizeof(stack_buf));
+    /* Mid-source the DS holds the open bodies' cells, so no stack yet. */
+    char stack_buf[128] = "";
+    if (!more)
+      format_stack(vm, stack_buf, sizeof(stack_buf));
 
     FROTH_TRY(pw_u8(&pw, 0));          /* status: success */
     FROTH_TRY(pw_u16(&pw, 0));         /* error_code */
@@ -203,8 +237,8 @@ static froth_error_t handle_eval(froth_vm_t *vm,
     /* FROTH_ERROR_RESET is a top-level control sentinel. Preserve the
        reset side effects instead of restoring the pre-eval stacks. */
     if (eval_err != FROTH_ERROR_RESET) {
-      vm->ds.pointer = ds_snap;
-      vm->rs.pointer = rs_snap;
+      vm->ds.pointer = eval_ds_snap;
+      vm->rs.pointer = eval_rs_snap;
     }
   }
 
@@ -255,7 +289,9 @@ static froth_error_t handle_reset(froth_vm_t *vm,
   /* Reset clears VM stacks, overlay slots, and heap back to watermark.
      The REPL line buffer is intentionally NOT cleared: the link and REPL
      own separate input streams. Any partially typed direct-mode input
-     remains the user's intent regardless of host-triggered resets. */
+     remains the user's intent regardless of host-triggered resets. A
+     source still open over EVAL_REQs is dropped. */
+  froth_link_eval_abort(vm);
   froth_error_t err = froth_prim_dangerous_reset(vm);
   uint32_t status = (err == FROTH_ERROR_RESET) ? 0 : (uint32_t)err;
   FROTH_TRY(pw_u32(&pw, status));
@@ -287,6 +323,117 @@ static froth_error_t handle_reset(froth_vm_t *vm,
                                header->seq, resp_buf, pw.pos);
 }
 
+/* ── PROF ────────────────────────────────────────────────────────── */
+
+#ifdef FROTH_PROFILE
+/* One page of per-word counters, starting at the slot in the request
+ * (ADR-058). Only called words are listed. The host asks again from
+ * next_slot until it equals slot_count. */
+static froth_error_t handle_prof(const froth_link_header_t *header,
+                                 const uint8_t *payload) {
+  if (header->payload_length != 2)
+    return FROTH_ERROR_LINK_TOO_LARGE;
+  froth_cell_u_t slot = (froth_cell_u_t)payload[0] |
+                        ((froth_cell_u_t)payload[1] << 8);
+  froth_cell_u_t slots = froth_slot_count();
+
+  payload_writer_t pw = {resp_buf, sizeof(resp_buf), 0};
+  FROTH_TRY(pw_u8(&pw, FROTH_PROFILE_ACTIVE() ? 1 : 0)); /* flags */
+  FROTH_TRY(pw_u32(&pw, froth_profile_elapsed_us()));
+  FROTH_TRY(pw_u32(&pw, froth_profile_unattributed_samples()));
+  FROTH_TRY(pw_u16(&pw, (uint16_t)slots));
+  uint16_t next_pos = pw.pos;
+  FROTH_TRY(pw_u16(&pw, 0)); /* next_slot, patched below */
+  uint16_t count_pos = pw.pos;
+  FROTH_TRY(pw_u8(&pw, 0)); /* entry_count, patched below */
+
+  uint8_t count = 0;
+  for (; slot < slots && count < UINT8_MAX; slot++) {
+    froth_profile_counts_t c;
+    const char *name;
+    if (!froth_profile_get(slot, &c) ||
+        froth_slot_get_name(slot, &name) != FROTH_OK)
+      continue;
+
+    uint16_t entry_pos = pw.pos;
+    froth_error_t err = pw_u16(&pw, (uint16_t)slot);
+    if (err == FROTH_OK)
+      err = pw_u8(&pw, froth_slot_entry(slot)->prim != NULL ? 1 : 0);
+    if (err == FROTH_OK)
+      err = pw_str(&pw, name);
+    if (err == FROTH_OK)
+      err = pw_u32(&pw, c.calls);
+    if (err == FROTH_OK)
+      err = pw_u32(&pw, c.inclusive_us);
+    if (err == FROTH_OK)
+      err = pw_u32(&pw, c.exclusive_us);
+    if (err == FROTH_OK)
+      err = pw_u32(&pw, c.samples);
+    if (err != FROTH_OK) {
+      /* Page full: this slot starts the next one. A name too long for
+       * an empty page is skipped. */
+      pw.pos = entry_pos;
+      if (count == 0)
+        slot++;
+      break;
+    }
+    count++;
+  }
+
+  resp_buf[next_pos] = slot & 0xFF;
+  resp_buf[next_pos + 1] = (slot >> 8) & 0xFF;
+  resp_buf[count_pos] = count;
+
+  FROTH_TRY(froth_console_flush_output());
+  return froth_link_send_frame(header->session_id, FROTH_LINK_PROF_RES,
+                               header->seq, resp_buf, pw.pos);
+}
+#endif
+
+/* ── MEM ─────────────────────────────────────────────────────────── */
+
+#ifdef FROTH_MEM_STATS
+/* Heap census and high-water marks (ADR-063): heap size, then the nine
+ * u32 heap figures of froth_mem_stats_t, then now, high and capacity as
+ * u16s for DS, RS, CS, ring and descriptors. Object bytes (ADR-064) come
+ * last, so hosts that predate them still parse the rest. */
+static froth_error_t handle_mem(froth_vm_t *vm,
+                                const froth_link_header_t *header) {
+  froth_mem_stats_t s;
+  froth_mem_stats(vm, &s);
+
+  payload_writer_t pw = {resp_buf, sizeof(resp_buf), 0};
+  FROTH_TRY(pw_u32(&pw, FROTH_HEAP_SIZE));
+  FROTH_TRY(pw_u32(&pw, s.heap_used));
+  FROTH_TRY(pw_u32(&pw, s.heap_high));
+  FROTH_TRY(pw_u32(&pw, s.boot));
+  FROTH_TRY(pw_u32(&pw, s.restored));
+  FROTH_TRY(pw_u32(&pw, s.names));
+  FROTH_TRY(pw_u32(&pw, s.quotes));
+  FROTH_TRY(pw_u32(&pw, s.patterns));
+  FROTH_TRY(pw_u32(&pw, s.strings));
+  FROTH_TRY(pw_u32(&pw, s.unreached));
+
+  const uint16_t usage[][3] = {
+      {s.ds, s.ds_high, FROTH_DS_CAPACITY},
+      {s.rs, s.rs_high, FROTH_RS_CAPACITY},
+      {s.cs, s.cs_high, FROTH_CS_CAPACITY},
+      {s.tbuf, s.tbuf_high, FROTH_TBUF_SIZE},
+      {s.tdesc, s.tdesc_high, FROTH_TDESC_MAX},
+  };
+  for (size_t i = 0; i < sizeof(usage) / sizeof(usage[0]); i++) {
+    FROTH_TRY(pw_u16(&pw, usage[i][0]));
+    FROTH_TRY(pw_u16(&pw, usage[i][1]));
+    FROTH_TRY(pw_u16(&pw, usage[i][2]));
+  }
+  FROTH_TRY(pw_u32(&pw, s.objects));
+
+  FROTH_TRY(froth_console_flush_output());
+  return froth_link_send_frame(header->session_id, FROTH_LINK_MEM_RES,
+                               header->seq, resp_buf, pw.pos);
+}
+#endif
+
 /* ── ERROR response ──────────────────────────────────────────────── */
 
 static froth_error_t send_error(const froth_link_header_t *header,
@@ -311,6 +458,14 @@ froth_error_t froth_link_dispatch(froth_vm_t *vm,
     return handle_info(vm, header);
   case FROTH_LINK_RESET_REQ:
     return handle_reset(vm, header);
+#ifdef FROTH_PROFILE
+  case FROTH_LINK_PROF_REQ:
+    return handle_prof(header, payload);
+#endif
+#ifdef FROTH_MEM_STATS
+  case FROTH_LINK_MEM_REQ:
+    return handle_mem(vm, header);
+#endif
   default:
     return send_error(header, 0, "unknown message type");
   }
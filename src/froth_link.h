@@ -5,6 +5,10 @@
 froth_error_t froth_link_send_hello_res(froth_vm_t *vm, uint64_t session_id,
                                         uint16_t seq);
 
+/* Drop a source left open by EVAL_REQs with FROTH_LINK_EVAL_MORE, as when
+ * the host detaches mid-source (ADR-072). */
+void froth_link_eval_abort(froth_vm_t *vm);
+
 froth_error_t froth_link_dispatch(froth_vm_t *vm,
                                   const froth_link_header_t *header,
                                   const uint8_t *payload);
@@ -0,0 +1,266 @@
+#ifdef FROTH_MAPS
+
+#include "froth_executor.h"
+#include "froth_gc.h"
+#include "froth_object.h"
+#include "froth_stack.h"
+#include "froth_tbuf.h"
+#include <string.h>
+
+/* Hash maps (ADR-065). Open addressing with linear probing over a fixed
+ * number of slots. Deleting an entry shifts the entries after it back, so
+ * there are no tombstones. The layout is described in froth_object.h. */
+
+/* A key being looked up: its cell, its hash and, for strings, its bytes. */
+typedef struct {
+  froth_cell_t cell;
+  uint32_t hash;
+  froth_bstring_view_t bytes;
+} map_key_t;
+
+/* Strings hash their bytes, not their offset, so a key keeps its slot when
+ * the collector moves it or a snapshot restores it elsewhere. */
+static froth_error_t key_init(froth_vm_t *vm, froth_cell_t cell,
+                              map_key_t *key) {
+  key->cell = cell;
+  if (FROTH_CELL_IS_NUMBER(cell)) {
+    uint32_t h = (uint32_t)FROTH_CELL_STRIP_TAG(cell) * 2654435769u;
+    key->hash = h ^ (h >> 16);
+    return FROTH_OK;
+  }
+  if (!FROTH_CELL_IS_BSTRING(cell))
+    return FROTH_ERROR_TYPE_MISMATCH;
+  FROTH_TRY(froth_bstring_resolve(vm, cell, &key->bytes));
+  key->hash = 2166136261u; /* FNV-1a */
+  for (froth_cell_t i = 0; i < key->bytes.len; i++)
+    key->hash = (key->hash ^ key->bytes.data[i]) * 16777619u;
+  return FROTH_OK;
+}
+
+static bool key_equal(froth_vm_t *vm, froth_cell_t stored,
+                      const map_key_t *key) {
+  froth_bstring_view_t view;
+
+  if (stored == key->cell)
+    return true;
+  if (!FROTH_CELL_IS_BSTRING(stored) || !FROTH_CELL_IS_BSTRING(key->cell))
+    return false;
+  if (froth_bstring_resolve(vm, stored, &view) != FROTH_OK)
+    return false;
+  return view.len == key->bytes.len &&
+         memcmp(view.data, key->bytes.data, (size_t)view.len) == 0;
+}
+
+static froth_cell_u_t map_slots(froth_heap_t *heap, froth_cell_u_t offset) {
+  return (froth_object_count(heap, offset) - FROTH_MAP_HEADER_CELLS) / 2;
+}
+
+/* Key cell of slot i; its value follows it. */
+static froth_cell_t *map_slot(froth_heap_t *heap, froth_cell_u_t offset,
+                              froth_cell_u_t i) {
+  return &froth_object_cells(heap, offset)[FROTH_MAP_HEADER_CELLS + 2 * i];
+}
+
+/* Find key's slot, or the empty slot where it would go. There is always an
+ * empty slot, because a map has more slots than its capacity. */
+static bool map_find(froth_vm_t *vm, froth_cell_u_t offset,
+                     const map_key_t *key, froth_cell_u_t *slot) {
+  froth_cell_t empty = froth_object_cell(offset);
+  froth_cell_u_t mask = map_slots(&vm->heap, offset) - 1;
+  froth_cell_u_t i = (froth_cell_u_t)(key->hash & mask);
+
+  for (;;) {
+    froth_cell_t stored = map_slot(&vm->heap, offset, i)[0];
+    if (stored == empty || key_equal(vm, stored, key)) {
+      *slot = i;
+      return stored != empty;
+    }
+    i = (i + 1) & mask;
+  }
+}
+
+static void set_count(froth_vm_t *vm, froth_cell_u_t offset,
+                      froth_cell_u_t count) {
+  froth_object_cells(&vm->heap, offset)[0] =
+      FROTH_CELL_PACK_TAG((froth_cell_t)count, FROTH_NUMBER);
+}
+
+/* Pop a map and a key: ( k map -- ). */
+static froth_error_t pop_key(froth_vm_t *vm, froth_cell_u_t *offset,
+                             map_key_t *key) {
+  froth_cell_t cell;
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_MAP, offset));
+  FROTH_TRY(froth_stack_pop(&vm->ds, &cell));
+  return key_init(vm, cell, key);
+}
+
+/* ---- map.new ---- ( n -- map )
+ * Room for n entries, in the smallest power of two of slots that keeps the
+ * table at most two-thirds full. */
+static froth_error_t prim_new(froth_vm_t *vm) {
+  froth_cell_t n;
+  froth_cell_u_t offset, slots = 1;
+
+  FROTH_TRY(froth_pop(vm, &n));
+  if (n < 0)
+    return FROTH_ERROR_BOUNDS;
+  if ((froth_cell_u_t)n > FROTH_HEAP_SIZE / sizeof(froth_cell_t))
+    return FROTH_ERROR_HEAP_OUT_OF_MEMORY;
+  while (slots <= (froth_cell_u_t)n + (froth_cell_u_t)n / 2)
+    slots *= 2;
+  FROTH_TRY(froth_object_allocate(&vm->heap, FROTH_OBJECT_MAP,
+                                  FROTH_MAP_HEADER_CELLS + 2 * slots,
+                                  &offset));
+
+  froth_object_cells(&vm->heap, offset)[1] =
+      FROTH_CELL_PACK_TAG(n, FROTH_NUMBER);
+  for (froth_cell_u_t i = 0; i < slots; i++)
+    map_slot(&vm->heap, offset, i)[0] = froth_object_cell(offset);
+  return froth_stack_push(&vm->ds, froth_object_cell(offset));
+}
+
+/* ---- map.len ---- ( map -- n ) */
+static froth_error_t prim_len(froth_vm_t *vm) {
+  froth_cell_u_t offset;
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_MAP, &offset));
+  return froth_push(vm, (froth_cell_t)froth_object_length(&vm->heap, offset));
+}
+
+/* ---- map@ ---- ( k map -- v ) */
+static froth_error_t prim_fetch(froth_vm_t *vm) {
+  froth_cell_u_t offset, slot;
+  map_key_t key;
+
+  FROTH_TRY(pop_key(vm, &offset, &key));
+  if (!map_find(vm, offset, &key, &slot))
+    return FROTH_ERROR_KEY_NOT_FOUND;
+  return froth_stack_push(&vm->ds, map_slot(&vm->heap, offset, slot)[1]);
+}
+
+/* ---- map! ---- ( v k map -- )
+ * Transient strings are promoted, as def does. A new key in a full map is
+ * BOUNDS: a map never grows, so its cell stays valid. */
+static froth_error_t prim_store(froth_vm_t *vm) {
+  froth_cell_t v;
+  froth_cell_u_t offset, slot;
+  map_key_t key;
+
+  FROTH_TRY(pop_key(vm, &offset, &key));
+  FROTH_TRY(froth_stack_pop(&vm->ds, &v));
+
+  if (!map_find(vm, offset, &key, &slot)) {
+    froth_cell_t *cells = froth_object_cells(&vm->heap, offset);
+    froth_cell_u_t count = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cells[0]);
+    if (count >= (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cells[1]))
+      return FROTH_ERROR_BOUNDS;
+    if (FROTH_CELL_IS_BSTRING(key.cell) &&
+        FROTH_BSTRING_IS_TRANSIENT(FROTH_CELL_STRIP_TAG(key.cell)))
+      FROTH_TRY(froth_bstring_promote(vm, key.cell, &key.cell));
+    map_slot(&vm->heap, offset, slot)[0] = key.cell;
+    set_count(vm, offset, count + 1);
+  }
+  if (FROTH_CELL_IS_BSTRING(v) &&
+      FROTH_BSTRING_IS_TRANSIENT(FROTH_CELL_STRIP_TAG(v)))
+    FROTH_TRY(froth_bstring_promote(vm, v, &v));
+  map_slot(&vm->heap, offset, slot)[1] = v;
+  return FROTH_OK;
+}
+
+/* ---- map? ---- ( k map -- flag ) */
+static froth_error_t prim_contains(froth_vm_t *vm) {
+  froth_cell_u_t offset, slot;
+  map_key_t key;
+
+  FROTH_TRY(pop_key(vm, &offset, &key));
+  return froth_push(vm, map_find(vm, offset, &key, &slot) ? -1 : 0);
+}
+
+/* ---- map.del ---- ( k map -- )
+ * Removing a missing key does nothing. Each later entry in the probe run
+ * moves into the hole if its home slot does not lie between the hole and
+ * where it is now. */
+static froth_error_t prim_delete(froth_vm_t *vm) {
+  froth_cell_u_t offset, hole, j;
+  map_key_t key;
+
+  FROTH_TRY(pop_key(vm, &offset, &key));
+  if (!map_find(vm, offset, &key, &hole))
+    return FROTH_OK;
+
+  froth_cell_t empty = froth_object_cell(offset);
+  froth_cell_u_t mask = map_slots(&vm->heap, offset) - 1;
+  for (j = (hole + 1) & mask; map_slot(&vm->heap, offset, j)[0] != empty;
+       j = (j + 1) & mask) {
+    froth_cell_t *entry = map_slot(&vm->heap, offset, j);
+    map_key_t moved;
+    FROTH_TRY(key_init(vm, entry[0], &moved));
+    froth_cell_u_t home = (froth_cell_u_t)(moved.hash & mask);
+    if (((j - home) & mask) >= ((j - hole) & mask)) {
+      froth_cell_t *to = map_slot(&vm->heap, offset, hole);
+      to[0] = entry[0];
+      to[1] = entry[1];
+      hole = j;
+    }
+  }
+
+  froth_cell_t *freed = map_slot(&vm->heap, offset, hole);
+  freed[0] = empty;
+  freed[1] = 0;
+  set_count(vm, offset,
+            (froth_cell_u_t)FROTH_CELL_STRIP_TAG(
+                froth_object_cells(&vm->heap, offset)[0]) -
+                1);
+  return FROTH_OK;
+}
+
+/* ---- map.each ---- ( map q -- )
+ * Calls q ( k v -- ) with each entry, in slot order. q may store into keys
+ * the map already has; adding or deleting keys may skip entries. */
+static froth_error_t prim_each(froth_vm_t *vm) {
+  froth_cell_t q;
+  froth_cell_u_t offset;
+  froth_error_t err = FROTH_OK;
+
+  FROTH_TRY(froth_stack_pop(&vm->ds, &q));
+  if (!FROTH_CELL_IS_QUOTE(q))
+    return FROTH_ERROR_TYPE_MISMATCH;
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_MAP, &offset));
+
+  froth_gc_hold(vm);
+  for (froth_cell_u_t i = 0; i < map_slots(&vm->heap, offset); i++) {
+    froth_cell_t *entry = map_slot(&vm->heap, offset, i);
+    if (entry[0] == froth_object_cell(offset))
+      continue;
+    err = froth_stack_push(&vm->ds, entry[0]);
+    if (err == FROTH_OK)
+      err = froth_stack_push(&vm->ds, entry[1]);
+    if (err == FROTH_OK)
+      err = froth_execute_quote(vm, q);
+    if (err != FROTH_OK)
+      break;
+  }
+  froth_gc_release(vm);
+  return err;
+}
+
+FROTH_FFI(prim_new, "map.new", "( n -- map )", "New map with room for n entries");
+FROTH_FFI(prim_len, "map.len", "( map -- n )", "Number of entries");
+FROTH_FFI(prim_fetch, "map@", "( k map -- v )", "Fetch the value under k");
+FROTH_FFI(prim_store, "map!", "( v k map -- )", "Store v under k");
+FROTH_FFI(prim_contains, "map?", "( k map -- flag )", "True if k has a value");
+FROTH_FFI(prim_delete, "map.del", "( k map -- )", "Remove k and its value");
+FROTH_FFI(prim_each, "map.each", "( map q -- )",
+          "Call q ( k v -- ) with each entry");
+
+const froth_ffi_entry_t froth_map_prims[] = {
+    FROTH_BIND(prim_new),
+    FROTH_BIND(prim_len),
+    FROTH_BIND(prim_fetch),
+    FROTH_BIND(prim_store),
+    FROTH_BIND(prim_contains),
+    FROTH_BIND(prim_delete),
+    FROTH_BIND(prim_each),
+    {0},
+};
+
+#endif /* FROTH_MAPS */
@@ -0,0 +1,221 @@
+#ifdef FROTH_MEM_STATS
+
+#include "froth_mem.h"
+#include "froth_body.h"
+#include "froth_fmt.h"
+#include "froth_object.h"
+#include "froth_slot_table.h"
+#include <string.h>
+
+/* Byte written over the free part of each stack at boot. An entry whose
+ * bytes all still hold it was never written; a cell that happens to equal
+ * it reads as unused, which can only lower a mark. */
+#define PAINT 0xA5
+
+froth_cell_u_t froth_mem_heap_high;
+static uint16_t tbuf_high;
+static uint16_t tdesc_high;
+static froth_cell_u_t restored;
+
+/* Objects already counted, one bit per heap byte: patterns and strings
+ * start at any byte and interned objects are shared (ADR-061). */
+static uint8_t seen[(FROTH_HEAP_SIZE + 7) / 8];
+
+void froth_mem_init(froth_vm_t *vm) {
+  memset(&vm->ds.data[vm->ds.pointer], PAINT,
+         (vm->ds.capacity - vm->ds.pointer) * sizeof(froth_cell_t));
+  memset(&vm->rs.data[vm->rs.pointer], PAINT,
+         (vm->rs.capacity - vm->rs.pointer) * sizeof(froth_cell_t));
+  memset(&vm->cs.data[vm->cs.pointer], PAINT,
+         (vm->cs.capacity - vm->cs.pointer) * sizeof(froth_cs_frame_t));
+  froth_mem_heap_high = vm->heap.pointer;
+}
+
+/* One past the deepest entry that is not all paint. */
+static uint16_t high_water(const void *data, size_t entry_size,
+                           froth_cell_u_t capacity) {
+  const uint8_t *bytes = data;
+  for (froth_cell_u_t n = capacity; n > 0; n--) {
+    const uint8_t *entry = &bytes[(n - 1) * entry_size];
+    for (size_t i = 0; i < entry_size; i++) {
+      if (entry[i] != PAINT)
+        return (uint16_t)n;
+    }
+  }
+  return 0;
+}
+
+static uint16_t live_descriptors(const froth_tbuf_t *tbuf) {
+  uint16_t live = 0;
+  for (int i = 0; i < FROTH_TDESC_MAX; i++) {
+    if (tbuf->descriptors[i].kind != FROTH_TDESC_FREE)
+      live++;
+  }
+  return live;
+}
+
+void froth_mem_note_tbuf(const froth_tbuf_t *tbuf) {
+  uint16_t live = live_descriptors(tbuf);
+  if (tbuf->write_cursor > tbuf_high)
+    tbuf_high = tbuf->write_cursor;
+  if (live > tdesc_high)
+    tdesc_high = live;
+}
+
+void froth_mem_note_restore(froth_cell_u_t bytes) { restored = bytes; }
+
+static bool first_visit(froth_cell_u_t offset) {
+  uint8_t bit = (uint8_t)(1u << (offset % 8));
+  if (seen[offset / 8] & bit)
+    return false;
+  seen[offset / 8] |= bit;
+  return true;
+}
+
+/* Count the object cell refers to, and everything its body refers to. */
+static void count_cell(froth_vm_t *vm, froth_cell_t cell,
+                       froth_mem_stats_t *stats) {
+  froth_cell_u_t offset = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell);
+  froth_cell_t tag = FROTH_CELL_GET_TAG(cell);
+
+  if (FROTH_CELL_IS_OBJECT(cell))
+    offset = froth_object_offset(cell);
+  else if (tag != FROTH_QUOTE && tag != FROTH_PATTERN && tag != FROTH_BSTRING)
+    return;
+  if (tag == FROTH_BSTRING && FROTH_BSTRING_IS_TRANSIENT(offset))
+    return;
+  /* A dangling object reference is skipped, not walked (ADR-060). */
+  if (tag == FROTH_EXT && !froth_object_in_heap(&vm->heap, offset))
+    return;
+  if (offset >= vm->heap.pointer || !first_visit(offset))
+    return;
+
+  froth_cell_u_t size = froth_heap_object_size(&vm->heap, cell);
+  if (tag == FROTH_PATTERN) {
+    stats->patterns += size;
+  } else if (tag == FROTH_BSTRING) {
+    stats->strings += size;
+  } else if (tag == FROTH_EXT) {
+    stats->objects += size;
+    froth_cell_u_t count = froth_object_count(&vm->heap, offset);
+    for (froth_cell_u_t i = 0; i < count; i++)
+      count_cell(vm, froth_object_cells(&vm->heap, offset)[i], stats);
+  } else {
+    stats->quotes += size;
+    froth_cell_u_t length = froth_body_length(&vm->heap, offset);
+    for (froth_cell_u_t ip = 1; ip <= length;)
+      count_cell(vm, froth_body_next(&vm->heap, offset, &ip), stats);
+  }
+}
+
+static void count_stack(froth_vm_t *vm, const froth_stack_t *stack,
+                        froth_mem_stats_t *stats) {
+  for (froth_cell_u_t i = 0; i < stack->pointer; i++)
+    count_cell(vm, stack->data[i], stats);
+}
+
+/* Roots as for the collector (ADR-059). */
+static void census(froth_vm_t *vm, froth_mem_stats_t *stats) {
+  memset(seen, 0, sizeof(seen));
+
+  froth_cell_u_t slots = froth_slot_count();
+  for (froth_cell_u_t i = 0; i < slots; i++) {
+    const froth_slot_t *slot = froth_slot_entry(i);
+    stats->names += (uint32_t)strlen(slot->name) + 1;
+    count_cell(vm, slot->impl, stats);
+  }
+
+  count_stack(vm, &vm->ds, stats);
+  count_stack(vm, &vm->rs, stats);
+  count_cell(vm, vm->thrown, stats);
+  for (froth_cell_u_t i = 0; i < vm->cs.pointer; i++) {
+    const froth_cs_frame_t *frame = &vm->cs.data[i];
+    if (frame->kind == FROTH_CS_CATCH)
+      continue;
+    count_cell(vm, FROTH_CELL_PACK_TAG(frame->quote_offset, FROTH_QUOTE),
+               stats);
+    if (frame->kind == FROTH_CS_WHILE_COND ||
+        frame->kind == FROTH_CS_WHILE_TEST)
+      count_cell(vm, FROTH_CELL_PACK_TAG(frame->ip, FROTH_QUOTE), stats);
+  }
+
+  uint32_t reached = stats->names + stats->quotes + stats->patterns +
+                     stats->strings + stats->objects;
+  stats->unreached = stats->heap_used > reached ? stats->heap_used - reached
+                                                : 0;
+}
+
+void froth_mem_stats(froth_vm_t *vm, froth_mem_stats_t *stats) {
+  memset(stats, 0, sizeof(*stats));
+  stats->heap_used = vm->heap.pointer;
+  stats->heap_high = froth_mem_heap_high;
+  stats->boot = vm->watermark_heap_offset;
+  stats->restored = restored;
+  census(vm, stats);
+
+  stats->ds = (uint16_t)vm->ds.pointer;
+  stats->ds_high = high_water(vm->ds.data, sizeof(froth_cell_t),
+                              vm->ds.capacity);
+  stats->rs = (uint16_t)vm->rs.pointer;
+  stats->rs_high = high_water(vm->rs.data, sizeof(froth_cell_t),
+                              vm->rs.capacity);
+  stats->cs = (uint16_t)vm->cs.pointer;
+  stats->cs_high = high_water(vm->cs.data, sizeof(froth_cs_frame_t),
+                              vm->cs.capacity);
+  stats->tbuf = vm->tbuf.write_cursor;
+  stats->tbuf_high = tbuf_high;
+  stats->tdesc = live_descriptors(&vm->tbuf);
+  stats->tdesc_high = tdesc_high;
+}
+
+static froth_error_t emit_field(const char *label, uint32_t value) {
+  FROTH_TRY(emit_string(label));
+  return emit_string(format_number((froth_cell_t)value));
+}
+
+/* "<name>: <now> / <capacity> <unit>, high <high>" */
+static froth_error_t emit_usage(const char *name, uint32_t now,
+                                uint32_t capacity, const char *unit,
+                                uint32_t high) {
+  FROTH_TRY(emit_field(name, now));
+  FROTH_TRY(emit_field(" / ", capacity));
+  FROTH_TRY(emit_string(unit));
+  FROTH_TRY(emit_field(", high ", high));
+  return emit_string("\n");
+}
+
+/* ---- mem.stats ---- ( -- ) */
+static froth_error_t prim_stats(froth_vm_t *vm) {
+  froth_mem_stats_t s;
+  froth_mem_stats(vm, &s);
+
+  FROTH_TRY(emit_usage("heap: ", s.heap_used, FROTH_HEAP_SIZE, " bytes",
+                       s.heap_high));
+  FROTH_TRY(emit_field("  boot ", s.boot));
+  FROTH_TRY(emit_field(" | restored ", s.restored));
+  FROTH_TRY(emit_field(" | names ", s.names));
+  FROTH_TRY(emit_field(" | quotes ", s.quotes));
+  FROTH_TRY(emit_field(" | patterns ", s.patterns));
+  FROTH_TRY(emit_field(" | strings ", s.strings));
+  FROTH_TRY(emit_field(" | objects ", s.objects));
+  FROTH_TRY(emit_field(" | unreached ", s.unreached));
+  FROTH_TRY(emit_string("\n"));
+  FROTH_TRY(emit_usage("ds: ", s.ds, FROTH_DS_CAPACITY, " cells", s.ds_high));
+  FROTH_TRY(emit_usage("rs: ", s.rs, FROTH_RS_CAPACITY, " cells", s.rs_high));
+  FROTH_TRY(
+      emit_usage("cs: ", s.cs, FROTH_CS_CAPACITY, " frames", s.cs_high));
+  FROTH_TRY(emit_usage("tbuf: ", s.tbuf, FROTH_TBUF_SIZE, " bytes",
+                       s.tbuf_high));
+  return emit_usage("tdesc: ", s.tdesc, FROTH_TDESC_MAX, " strings",
+                    s.tdesc_high);
+}
+
+FROTH_FFI(prim_stats, "mem.stats", "( -- )",
+          "Print heap use by kind and memory high-water marks");
+
+const froth_ffi_entry_t froth_mem_prims[] = {
+    FROTH_BIND(prim_stats),
+    {0},
+};
+
+#endif /* FROTH_MEM_STATS */
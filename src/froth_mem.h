@@ -0,0 +1,81 @@
+#pragma once
+
+#include "froth_ffi.h"
+#include "froth_tbuf.h"
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdint.h>
+
+/* Memory accounting (ADR-063).
+ *
+ * Two kinds of figure, for sizing FROTH_HEAP_SIZE, the stack capacities
+ * and the transient buffer per product:
+ *
+ * - A census of the heap, taken on request. It walks everything reachable
+ *   from the slot table, DS and RS, and sorts the bytes it reaches into
+ *   slot names, quotations, patterns, permanent strings and objects.
+ *   Whatever it does not reach is alignment padding or garbage.
+ * - High-water marks since boot. The DS, RS and CS are painted at boot and
+ *   measured by finding the deepest entry that was written, so the
+ *   executor pays nothing. The heap, ring and descriptor marks are kept by
+ *   their allocators.
+ *
+ * mem.stats prints both and MEM_RES carries them to the host. */
+
+typedef struct {
+  uint32_t heap_used;
+  uint32_t heap_high;
+  uint32_t boot;       /* below watermark_heap_offset */
+  uint32_t restored;   /* loaded by the last restore */
+  uint32_t names;      /* slot names */
+  uint32_t quotes;     /* quotations, length cell included */
+  uint32_t patterns;   /* patterns */
+  uint32_t strings;    /* permanent strings */
+  uint32_t objects;    /* arrays and other mutable objects, header included */
+  uint32_t unreached;  /* padding and garbage */
+  uint16_t ds, ds_high;
+  uint16_t rs, rs_high;
+  uint16_t cs, cs_high;
+  uint16_t tbuf, tbuf_high;   /* ring write cursor */
+  uint16_t tdesc, tdesc_high; /* live descriptors */
+} froth_mem_stats_t;
+
+#ifdef FROTH_MEM_STATS
+
+extern froth_cell_u_t froth_mem_heap_high;
+
+/* Paint the free part of each stack. Call once at boot, before anything
+ * runs. */
+void froth_mem_init(froth_vm_t *vm);
+
+/* Take a census and read the high-water marks. */
+void froth_mem_stats(froth_vm_t *vm, froth_mem_stats_t *stats);
+
+/* The heap grew to pointer. */
+static inline void froth_mem_note_heap(froth_cell_u_t pointer) {
+  if (pointer > froth_mem_heap_high)
+    froth_mem_heap_high = pointer;
+}
+
+/* A transient string was written to the ring. */
+void froth_mem_note_tbuf(const froth_tbuf_t *tbuf);
+
+/* A restore loaded bytes of overlay, or a reset dropped it (0). */
+void froth_mem_note_restore(froth_cell_u_t bytes);
+
+extern const froth_ffi_entry_t froth_mem_prims[];
+
+#else /* !FROTH_MEM_STATS */
+
+static inline void froth_mem_init(froth_vm_t *vm) { (void)vm; }
+static inline void froth_mem_note_heap(froth_cell_u_t pointer) {
+  (void)pointer;
+}
+static inline void froth_mem_note_tbuf(const froth_tbuf_t *tbuf) {
+  (void)tbuf;
+}
+static inline void froth_mem_note_restore(froth_cell_u_t bytes) {
+  (void)bytes;
+}
+
+#endif /* FROTH_MEM_STATS */
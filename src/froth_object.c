@@ -0,0 +1,58 @@
+#include "froth_object.h"
+#include "froth_stack.h"
+#include <string.h>
+
+froth_error_t froth_object_allocate(froth_heap_t *heap,
+                                    froth_object_kind_t kind,
+                                    froth_cell_u_t count,
+                                    froth_cell_u_t *offset) {
+  froth_cell_t *cells;
+
+  if (count > FROTH_HEAP_SIZE / sizeof(froth_cell_t))
+    return FROTH_ERROR_HEAP_OUT_OF_MEMORY;
+  FROTH_TRY(froth_heap_allocate_cells(1 + count, heap, &cells, offset));
+  cells[0] = (froth_cell_t)((count << 3) | kind);
+  memset(&cells[1], 0, count * sizeof(froth_cell_t)); /* number 0 */
+  return FROTH_OK;
+}
+
+froth_error_t froth_object_pop(froth_vm_t *vm, froth_object_kind_t kind,
+                               froth_cell_u_t *offset) {
+  froth_cell_t cell;
+
+  FROTH_TRY(froth_stack_pop(&vm->ds, &cell));
+  if (!FROTH_CELL_IS_OBJECT(cell))
+    return FROTH_ERROR_TYPE_MISMATCH;
+  *offset = froth_object_offset(cell);
+  if (!froth_object_in_heap(&vm->heap, *offset))
+    return FROTH_ERROR_BOUNDS;
+  if (froth_object_kind(&vm->heap, *offset) != kind)
+    return FROTH_ERROR_TYPE_MISMATCH;
+  return FROTH_OK;
+}
+
+froth_cell_u_t froth_object_length(froth_heap_t *heap, froth_cell_u_t offset) {
+  switch (froth_object_kind(heap, offset)) {
+  case FROTH_OBJECT_MAP:
+    return (froth_cell_u_t)FROTH_CELL_STRIP_TAG(
+        froth_object_cells(heap, offset)[0]);
+  case FROTH_OBJECT_RING:
+    return (froth_cell_u_t)FROTH_CELL_STRIP_TAG(
+        froth_object_cells(heap, offset)[1]);
+  default:
+    return froth_object_count(heap, offset);
+  }
+}
+
+const char *froth_object_kind_name(froth_object_kind_t kind) {
+  switch (kind) {
+  case FROTH_OBJECT_ARRAY:
+    return "arr";
+  case FROTH_OBJECT_MAP:
+    return "map";
+  case FROTH_OBJECT_RING:
+    return "ring";
+  default:
+    return "obj";
+  }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "froth_ffi.h"
+#include "froth_heap.h"
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdbool.h>
+
+/* Mutable heap objects (ADR-064).
+ *
+ * An object cell is tag 7 with payload bit 0 set, and the heap offset of
+ * the object in the payload bits above it. On the heap an object is a
+ * header cell followed by its body:
+ *
+ *   [header: count << 3 | kind][cell 0] ... [cell count-1]
+ *
+ * Every body cell holds a Froth value, and kinds keep their bookkeeping in
+ * number cells. The collector, snapshots and the census therefore treat
+ * all kinds alike: any reference in a body keeps its object alive.
+ *
+ * Objects are never interned and never appear in quotation bodies. They
+ * reach the program through the DS and slot values only. */
+
+typedef enum {
+  FROTH_OBJECT_ARRAY = 0,
+  FROTH_OBJECT_MAP = 1,
+  FROTH_OBJECT_RING = 2,
+} froth_object_kind_t;
+
+/* A map (ADR-065) is a fixed table of key/value slot pairs after two number
+ * cells, the entry count and the capacity:
+ *
+ *   [count][capacity][key 0][value 0] ... [key slots-1][value slots-1]
+ *
+ * The number of slots is a power of two. A slot is empty when its key is
+ * the map's own object cell: keys are numbers or strings, so that cell can
+ * never be a key, and the collector and snapshots already keep it current. */
+#define FROTH_MAP_HEADER_CELLS 2
+
+/* A ring (ADR-066) is a fixed window of elements after two number cells,
+ * the slot of the oldest element and the number of elements:
+ *
+ *   [start][length][slot 0] ... [slot capacity-1]
+ *
+ * The elements run from start, wrapping at the end of the body. */
+#define FROTH_RING_HEADER_CELLS 2
+
+static inline froth_cell_t froth_object_cell(froth_cell_u_t offset) {
+  /* Unsigned, so offsets past FROTH_MAX_CELL_VALUE / 2 still round-trip. */
+  return (froth_cell_t)((((froth_cell_u_t)offset << 1 | 1) << 3) | FROTH_EXT);
+}
+
+static inline froth_cell_u_t froth_object_offset(froth_cell_t cell) {
+  return (froth_cell_u_t)cell >> 4;
+}
+
+static inline froth_cell_u_t froth_object_count(const froth_heap_t *heap,
+                                                froth_cell_u_t offset) {
+  return (froth_cell_u_t)((const froth_cell_t *)&heap->data[offset])[0] >> 3;
+}
+
+static inline froth_object_kind_t froth_object_kind(const froth_heap_t *heap,
+                                                    froth_cell_u_t offset) {
+  return (froth_object_kind_t)(((const froth_cell_t *)&heap->data[offset])[0] &
+                               7);
+}
+
+/* First body cell of the object at offset. */
+static inline froth_cell_t *froth_object_cells(froth_heap_t *heap,
+                                               froth_cell_u_t offset) {
+  return &((froth_cell_t *)&heap->data[offset])[1];
+}
+
+/* True if a whole object, header and count body cells, lies cell-aligned
+ * below the heap pointer at offset. A reference can outlive its arena
+ * (ADR-060), and whatever is allocated there next is read as its header,
+ * so code that walks a body by its count checks this first. */
+static inline bool froth_object_in_heap(const froth_heap_t *heap,
+                                        froth_cell_u_t offset) {
+  if (offset % sizeof(froth_cell_t) != 0 || offset >= heap->pointer ||
+      heap->pointer - offset < sizeof(froth_cell_t))
+    return false;
+  return froth_object_count(heap, offset) <=
+         (heap->pointer - offset) / sizeof(froth_cell_t) - 1;
+}
+
+/* Allocate an object with count body cells, all number 0. */
+froth_error_t froth_object_allocate(froth_heap_t *heap,
+                                    froth_object_kind_t kind,
+                                    froth_cell_u_t count,
+                                    froth_cell_u_t *offset);
+
+/* Pop an object cell of the given kind and return its offset. An object
+ * that no longer fits below the heap pointer is a bounds error. */
+froth_error_t froth_object_pop(froth_vm_t *vm, froth_object_kind_t kind,
+                               froth_cell_u_t *offset);
+
+/* Number of elements (arrays, rings) or entries (maps) in the object at
+ * offset. */
+froth_cell_u_t froth_object_length(froth_heap_t *heap, froth_cell_u_t offset);
+
+/* Display name of a kind: "arr", "map" or "ring". */
+const char *froth_object_kind_name(froth_object_kind_t kind);
+
+#ifdef FROTH_ARRAYS
+extern const froth_ffi_entry_t froth_array_prims[];
+#endif
+
+#ifdef FROTH_MAPS
+extern const froth_ffi_entry_t froth_map_prims[];
+#endif
+
+#ifdef FROTH_RINGS
+extern const froth_ffi_entry_t froth_ring_prims[];
+#endif
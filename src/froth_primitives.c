@@ -1,13 +1,22 @@
 #include "froth_primitives.h"
+#include "froth_aot.h"
+#include "froth_body.h"
 #include "froth_console.h"
 #include "froth_executor.h"
 #include "froth_fmt.h"
+#include "froth_fuse.h"
 #include "froth_heap.h"
+#include "froth_intern.h"
+#include "froth_jit.h"
+#include "froth_mem.h"
+#include "froth_object.h"
 #include "froth_slot_table.h"
 #include "froth_stack.h"
 #include "froth_tbuf.h"
 #include "froth_types.h"
+#include "froth_verify.h"
 #include "froth_vm.h"
+#include "froth_vocab.h"
 #include "platform.h"
 #include <stdbool.h>
 #include <stdio.h>
@@ -25,10 +34,14 @@ froth_error_t froth_prim_def(froth_vm_t *froth_vm) {
 
   froth_cell_u_t slot_index = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(slot_cell);
 
-  /* Reject redefinition of slots that have a C primitive bound. */
+  /* Reject redefinition of slots that have a C primitive bound. Words
+   * compiled from a library at build time (ADR-056) stay redefinable. */
   froth_native_word_t existing_prim;
+  bool compiled = false;
   if (froth_slot_get_prim(slot_index, &existing_prim) == FROTH_OK) {
-    return FROTH_ERROR_REDEF_PRIMITIVE;
+    if (!froth_aot_is_compiled(existing_prim))
+      return FROTH_ERROR_REDEF_PRIMITIVE;
+    compiled = true;
   }
 
   if (FROTH_CELL_IS_BSTRING(impl_cell)) {
@@ -38,9 +51,17 @@ froth_error_t froth_prim_def(froth_vm_t *froth_vm) {
     }
   }
 
+  if (FROTH_CELL_IS_QUOTE(impl_cell)) {
+    froth_fuse_quote(froth_vm, impl_cell);
+  }
+
+  if (compiled)
+    FROTH_TRY(froth_slot_set_prim(slot_index, NULL));
   FROTH_TRY(froth_slot_set_impl(slot_index, impl_cell));
   FROTH_TRY(
       froth_slot_set_overlay(slot_index, froth_vm->boot_complete ? 1 : 0));
+  froth_fuse_note_def(froth_vm, slot_index, impl_cell);
+  froth_verify_slot(froth_vm, slot_index);
 
   return FROTH_OK;
 }
@@ -82,7 +103,10 @@ froth_error_t froth_prim_call(froth_vm_t *froth_vm) {
   return FROTH_OK;
 }
 
-froth_error_t froth_prim_add(froth_vm_t *froth_vm) {
+/* Binary number words share one body. The arithmetic lives in a
+ * froth_binop_t so the executor can run it on a cached top of stack
+ * (ADR-054) with the same result and error. */
+static froth_error_t run_binop(froth_vm_t *froth_vm, froth_binop_t op) {
   froth_cell_t a_cell, b_cell;
 
   FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
@@ -95,66 +119,93 @@ froth_error_t froth_prim_add(froth_vm_t *froth_vm) {
     return FROTH_ERROR_TYPE_MISMATCH;
   }
 
-  froth_cell_t a = FROTH_CELL_STRIP_TAG(a_cell);
-  froth_cell_t b = FROTH_CELL_STRIP_TAG(b_cell);
-  froth_cell_t wrapped =
-      froth_wrap_payload((froth_cell_u_t)a + (froth_cell_u_t)b);
-
   froth_cell_t result;
-  FROTH_TRY(froth_make_cell(wrapped, FROTH_NUMBER, &result));
+  FROTH_TRY(op(FROTH_CELL_STRIP_TAG(a_cell), FROTH_CELL_STRIP_TAG(b_cell),
+               &result));
   FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
 
   return FROTH_OK;
 }
 
-froth_error_t froth_prim_sub(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
+static froth_error_t binop_add(froth_cell_t a, froth_cell_t b,
+                               froth_cell_t *result) {
+  return froth_make_cell(
+      froth_wrap_payload((froth_cell_u_t)a + (froth_cell_u_t)b), FROTH_NUMBER,
+      result);
+}
 
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
+static froth_error_t binop_sub(froth_cell_t a, froth_cell_t b,
+                               froth_cell_t *result) {
+  return froth_make_cell(
+      froth_wrap_payload((froth_cell_u_t)a - (froth_cell_u_t)b), FROTH_NUMBER,
+      result);
+}
 
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
+static froth_error_t binop_mul(froth_cell_t a, froth_cell_t b,
+                               froth_cell_t *result) {
+  return froth_make_cell(
+      froth_wrap_payload((froth_cell_u_t)a * (froth_cell_u_t)b), FROTH_NUMBER,
+      result);
+}
 
-  froth_cell_t a = FROTH_CELL_STRIP_TAG(a_cell);
-  froth_cell_t b = FROTH_CELL_STRIP_TAG(b_cell);
-  froth_cell_t wrapped =
-      froth_wrap_payload((froth_cell_u_t)a - (froth_cell_u_t)b);
+static froth_error_t binop_lt(froth_cell_t a, froth_cell_t b,
+                              froth_cell_t *result) {
+  return froth_make_cell(a < b ? -1 : 0, FROTH_NUMBER, result);
+}
 
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(wrapped, FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
+static froth_error_t binop_eq(froth_cell_t a, froth_cell_t b,
+                              froth_cell_t *result) {
+  return froth_make_cell(a == b ? -1 : 0, FROTH_NUMBER, result);
+}
 
-  return FROTH_OK;
+static froth_error_t binop_gt(froth_cell_t a, froth_cell_t b,
+                              froth_cell_t *result) {
+  return froth_make_cell(a > b ? -1 : 0, FROTH_NUMBER, result);
 }
 
-froth_error_t froth_prim_mul(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
+static froth_error_t binop_and(froth_cell_t a, froth_cell_t b,
+                               froth_cell_t *result) {
+  return froth_make_cell(a & b, FROTH_NUMBER, result);
+}
 
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
+static froth_error_t binop_or(froth_cell_t a, froth_cell_t b,
+                              froth_cell_t *result) {
+  return froth_make_cell(a | b, FROTH_NUMBER, result);
+}
 
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
+static froth_error_t binop_xor(froth_cell_t a, froth_cell_t b,
+                               froth_cell_t *result) {
+  return froth_make_cell(a ^ b, FROTH_NUMBER, result);
+}
+
+static froth_error_t binop_shl(froth_cell_t a, froth_cell_t b,
+                               froth_cell_t *result) {
+  return froth_make_cell(
+      froth_wrap_payload((froth_cell_u_t)a << (froth_cell_u_t)b), FROTH_NUMBER,
+      result);
+}
 
-  froth_cell_t a = FROTH_CELL_STRIP_TAG(a_cell);
-  froth_cell_t b = FROTH_CELL_STRIP_TAG(b_cell);
+static froth_error_t binop_shr(froth_cell_t a, froth_cell_t b,
+                               froth_cell_t *result) {
+  const froth_cell_u_t pmask =
+      ((froth_cell_u_t)1 << (FROTH_CELL_SIZE_BITS - 3)) -
+      1; // Mask for valid payload bits
+  // Mask 'a' to payload bits before shifting, then wrap
   froth_cell_t wrapped =
-      froth_wrap_payload((froth_cell_u_t)a * (froth_cell_u_t)b);
+      froth_wrap_payload(((froth_cell_u_t)a & pmask) >> (froth_cell_u_t)b);
+  return froth_make_cell(wrapped, FROTH_NUMBER, result);
+}
 
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(wrapped, FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
+froth_error_t froth_prim_add(froth_vm_t *froth_vm) {
+  return run_binop(froth_vm, binop_add);
+}
 
-  return FROTH_OK;
+froth_error_t froth_prim_sub(froth_vm_t *froth_vm) {
+  return run_binop(froth_vm, binop_sub);
+}
+
+froth_error_t froth_prim_mul(froth_vm_t *froth_vm) {
+  return run_binop(froth_vm, binop_mul);
 }
 
 froth_error_t froth_prim_divmod(froth_vm_t *froth_vm) {
@@ -197,17 +248,17 @@ froth_error_t froth_prim_pat(froth_vm_t *froth_vm) {
     return FROTH_ERROR_TYPE_MISMATCH;
   }
 
-  froth_cell_t *body =
-      froth_heap_cell_ptr(&froth_vm->heap, FROTH_CELL_STRIP_TAG(quote_cell));
-  froth_cell_t len = body[0];
+  froth_cell_u_t body = FROTH_CELL_STRIP_TAG(quote_cell);
+  froth_cell_u_t len = froth_body_count(&froth_vm->heap, body);
+  froth_cell_u_t ip = 1;
 
   if (len > FROTH_MAX_PERM_SIZE) {
     return FROTH_ERROR_PATTERN_TOO_LARGE;
   }
 
   // Validate: every body cell must be a non-negative number that fits in a byte
-  for (froth_cell_t i = 0; i < len; i++) {
-    froth_cell_t cell = body[1 + i];
+  for (froth_cell_u_t i = 0; i < len; i++) {
+    froth_cell_t cell = froth_body_next(&froth_vm->heap, body, &ip);
     if (!FROTH_CELL_IS_NUMBER(cell)) {
       return FROTH_ERROR_PATTERN_INVALID;
     }
@@ -222,8 +273,10 @@ froth_error_t froth_prim_pat(froth_vm_t *froth_vm) {
   FROTH_TRY(froth_heap_allocate_bytes(1 + len, &froth_vm->heap, &pat_offset));
   uint8_t *pat = &froth_vm->heap.data[pat_offset];
   pat[0] = (uint8_t)len;
-  for (froth_cell_t i = 0; i < len; i++) {
-    pat[1 + i] = (uint8_t)FROTH_CELL_STRIP_TAG(body[1 + i]);
+  ip = 1;
+  for (froth_cell_u_t i = 0; i < len; i++) {
+    froth_cell_t token = froth_body_next(&froth_vm->heap, body, &ip);
+    pat[1 + i] = (uint8_t)FROTH_CELL_STRIP_TAG(token);
   }
 
   froth_cell_t result;
@@ -244,7 +297,6 @@ froth_error_t froth_prim_perm(froth_vm_t *froth_vm) {
     return FROTH_ERROR_TYPE_MISMATCH;
   }
   uint8_t *pattern = &froth_vm->heap.data[FROTH_CELL_STRIP_TAG(pattern_cell)];
-  uint8_t pattern_len = pattern[0];
 
   // Pop window size
   froth_cell_t window_cell;
@@ -252,7 +304,17 @@ froth_error_t froth_prim_perm(froth_vm_t *froth_vm) {
   if (!FROTH_CELL_IS_NUMBER(window_cell)) {
     return FROTH_ERROR_TYPE_MISMATCH;
   }
-  froth_cell_t window_size = FROTH_CELL_STRIP_TAG(window_cell);
+
+  return froth_perm_apply(froth_vm, FROTH_CELL_STRIP_TAG(window_cell),
+                          pattern);
+}
+
+/* The body of perm once its operands are popped. Build-time compiled words
+ * (ADR-056) call it with a constant window and pattern. */
+froth_error_t froth_perm_apply(froth_vm_t *froth_vm, froth_cell_t window_size,
+                               const uint8_t *pattern) {
+  uint8_t pattern_len = pattern[0];
+
   if (window_size < 0 || window_size > FROTH_MAX_PERM_SIZE) {
     return FROTH_ERROR_PATTERN_INVALID;
   }
@@ -285,91 +347,19 @@ froth_error_t froth_prim_perm(froth_vm_t *froth_vm) {
 }
 
 froth_error_t froth_prim_compare_lt(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(
-      FROTH_CELL_STRIP_TAG(a_cell) < FROTH_CELL_STRIP_TAG(b_cell) ? -1 : 0,
-      FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_lt);
 }
 
 froth_error_t froth_prim_compare_eq(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(
-      FROTH_CELL_STRIP_TAG(a_cell) == FROTH_CELL_STRIP_TAG(b_cell) ? -1 : 0,
-      FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_eq);
 }
 
 froth_error_t froth_prim_compare_gt(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(
-      FROTH_CELL_STRIP_TAG(a_cell) > FROTH_CELL_STRIP_TAG(b_cell) ? -1 : 0,
-      FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_gt);
 }
 
 froth_error_t froth_prim_bitwise_and(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(FROTH_CELL_STRIP_TAG(a_cell) &
-                                FROTH_CELL_STRIP_TAG(b_cell),
-                            FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_and);
 }
 
 froth_error_t froth_prim_choose(froth_vm_t *froth_vm) {
@@ -389,98 +379,19 @@ froth_error_t froth_prim_choose(froth_vm_t *froth_vm) {
   return FROTH_OK;
 }
 
+/* while and catch run as CS control frames (ADR-053). Inside a quotation
+ * the executor handles them itself. These wrappers only run when the word
+ * is executed from outside the trampoline, i.e. by froth_execute_slot. */
 froth_error_t froth_prim_while(froth_vm_t *froth_vm) {
-  froth_cell_t body_cell, condition_cell, condition_result_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &body_cell));
-  if (!FROTH_CELL_IS_QUOTE(body_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &condition_cell));
-  if (!FROTH_CELL_IS_QUOTE(condition_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_u_t stack_depth = froth_vm->ds.pointer;
-
-  for (;;) {
-    // Check for interrupt flag here.
-    if (froth_vm->interrupted) {
-      froth_vm->interrupted =
-          0; // Clear the flag so that if the user re-issues the command, it
-             // will run instead of immediately interrupting again.
-      froth_vm->thrown = FROTH_ERROR_PROGRAM_INTERRUPTED;
-      return FROTH_ERROR_THROW;
-    }
-    // Execute condition
-    FROTH_TRY(froth_execute_quote(froth_vm, condition_cell));
-    // Check data stack is depth + 1 ONLY.
-    if (froth_vm->ds.pointer != stack_depth + 1) {
-      return FROTH_ERROR_WHILE_STACK;
-    }
-    // Get the condition result and validate it's a number
-    FROTH_TRY(froth_stack_pop(&froth_vm->ds, &condition_result_cell));
-    if (!FROTH_CELL_IS_NUMBER(condition_result_cell)) {
-      return FROTH_ERROR_TYPE_MISMATCH;
-    }
-
-    if (FROTH_CELL_STRIP_TAG(condition_result_cell) == 0) {
-      break;
-    }
-
-    // Execute body
-    FROTH_TRY(froth_execute_quote(froth_vm, body_cell));
-    // Check no cells have been added to stack beyond the condition result.
-    if (froth_vm->ds.pointer != stack_depth) {
-      return FROTH_ERROR_WHILE_STACK;
-    }
-  }
-
-  return FROTH_OK;
+  return froth_execute_control(froth_vm, FROTH_CODE_WHILE);
 }
 
 froth_error_t froth_prim_bitwise_or(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(FROTH_CELL_STRIP_TAG(a_cell) |
-                                FROTH_CELL_STRIP_TAG(b_cell),
-                            FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_or);
 }
 
 froth_error_t froth_prim_bitwise_xor(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(FROTH_CELL_STRIP_TAG(a_cell) ^
-                                FROTH_CELL_STRIP_TAG(b_cell),
-                            FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_xor);
 }
 
 froth_error_t froth_prim_bitwise_invert(froth_vm_t *froth_vm) {
@@ -500,54 +411,11 @@ froth_error_t froth_prim_bitwise_invert(froth_vm_t *froth_vm) {
 }
 
 froth_error_t froth_prim_bitwise_shl(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(
-      froth_wrap_payload((froth_cell_u_t)FROTH_CELL_STRIP_TAG(a_cell)
-                         << (froth_cell_u_t)FROTH_CELL_STRIP_TAG(b_cell)),
-      FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_shl);
 }
 
 froth_error_t froth_prim_bitwise_shr(froth_vm_t *froth_vm) {
-  froth_cell_t a_cell, b_cell;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &b_cell));
-  if (!FROTH_CELL_IS_NUMBER(b_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &a_cell));
-  if (!FROTH_CELL_IS_NUMBER(a_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
-
-  froth_cell_u_t a = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(a_cell);
-  froth_cell_u_t b = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(b_cell);
-  const froth_cell_u_t pmask =
-      ((froth_cell_u_t)1 << (FROTH_CELL_SIZE_BITS - 3)) -
-      1; // Mask for valid payload bits
-  froth_cell_t wrapped = froth_wrap_payload(
-      (a & pmask) >> b); // Mask 'a' to payload bits before shifting, then wrap
-
-  froth_cell_t result;
-  FROTH_TRY(froth_make_cell(wrapped, FROTH_NUMBER, &result));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, result));
-
-  return FROTH_OK;
+  return run_binop(froth_vm, binop_shr);
 }
 
 // Prints the given cell as a text representation to the output.
@@ -627,40 +495,70 @@ froth_error_t froth_prim_throw(froth_vm_t *froth_vm) {
 };
 
 froth_error_t froth_prim_catch(froth_vm_t *froth_vm) {
-  froth_cell_t body_cell, ecode_cell, flag_cell;
-  froth_cell_u_t ds_depth, rs_depth, cs_depth;
-
-  FROTH_TRY(froth_stack_pop(&froth_vm->ds, &body_cell));
-  if (!FROTH_CELL_IS_QUOTE(body_cell)) {
-    return FROTH_ERROR_TYPE_MISMATCH;
-  }
+  return froth_execute_control(froth_vm, FROTH_CODE_CATCH);
+}
 
-  ds_depth = froth_vm->ds.pointer;
-  rs_depth = froth_vm->rs.pointer;
-  cs_depth = froth_vm->cs.pointer;
+froth_code_kind_t froth_prim_code(froth_native_word_t prim) {
+  if (prim == froth_prim_while)
+    return FROTH_CODE_WHILE;
+  if (prim == froth_prim_catch)
+    return FROTH_CODE_CATCH;
+  if (prim == froth_prim_call)
+    return FROTH_CODE_CALL;
+  return FROTH_CODE_PRIM;
+}
 
-  froth_error_t err = froth_execute_quote(froth_vm, body_cell);
-  if (err != FROTH_OK) {
-    froth_vm->ds.pointer = ds_depth;
-    froth_vm->rs.pointer = rs_depth;
-    froth_vm->cs.pointer = cs_depth;
-
-    /* For explicit throw, vm->thrown is already set.
-     * For other runtime errors, the C error code IS the user-visible code. */
-    froth_cell_t error_code =
-        (err == FROTH_ERROR_THROW) ? froth_vm->thrown : (froth_cell_t)err;
-    FROTH_TRY(froth_make_cell(error_code, FROTH_NUMBER, &ecode_cell));
-    FROTH_TRY(froth_make_cell(FROTH_FALSE, FROTH_NUMBER, &flag_cell));
-    FROTH_TRY(froth_stack_push(&froth_vm->ds, ecode_cell));
-    FROTH_TRY(froth_stack_push(&froth_vm->ds, flag_cell));
-    return FROTH_OK;
-  }
+froth_binop_t froth_prim_binop(froth_native_word_t prim) {
+  if (prim == froth_prim_add)
+    return binop_add;
+  if (prim == froth_prim_sub)
+    return binop_sub;
+  if (prim == froth_prim_mul)
+    return binop_mul;
+  if (prim == froth_prim_compare_lt)
+    return binop_lt;
+  if (prim == froth_prim_compare_eq)
+    return binop_eq;
+  if (prim == froth_prim_compare_gt)
+    return binop_gt;
+  if (prim == froth_prim_bitwise_and)
+    return binop_and;
+  if (prim == froth_prim_bitwise_or)
+    return binop_or;
+  if (prim == froth_prim_bitwise_xor)
+    return binop_xor;
+  if (prim == froth_prim_bitwise_shl)
+    return binop_shl;
+  if (prim == froth_prim_bitwise_shr)
+    return binop_shr;
+  return NULL;
+}
 
-  FROTH_TRY(froth_make_cell(FROTH_OK, FROTH_NUMBER, &ecode_cell));
-  FROTH_TRY(froth_make_cell(FROTH_TRUE, FROTH_NUMBER, &flag_cell));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, ecode_cell));
-  FROTH_TRY(froth_stack_push(&froth_vm->ds, flag_cell));
-  return FROTH_OK;
+bool froth_prim_fold(froth_native_word_t prim, const froth_cell_t *top,
+                     froth_cell_u_t available, froth_cell_u_t *arity,
+                     froth_cell_t *result) {
+  froth_binop_t op = froth_prim_binop(prim);
+
+  if (op != NULL) {
+    if (available < 2 || !FROTH_CELL_IS_NUMBER(top[-2]) ||
+        !FROTH_CELL_IS_NUMBER(top[-1]))
+      return false;
+    froth_cell_t b = FROTH_CELL_STRIP_TAG(top[-1]);
+    // Leave a shift C doesn't define to the target's own shift at run time
+    if ((op == binop_shl || op == binop_shr) &&
+        (b < 0 || b >= FROTH_CELL_SIZE_BITS))
+      return false;
+    *arity = 2;
+    return op(FROTH_CELL_STRIP_TAG(top[-2]), b, result) == FROTH_OK;
+  }
+  if (prim == froth_prim_bitwise_invert) {
+    if (available < 1 || !FROTH_CELL_IS_NUMBER(top[-1]))
+      return false;
+    *arity = 1;
+    return froth_make_cell(froth_wrap_payload(~FROTH_CELL_STRIP_TAG(top[-1])),
+                           FROTH_NUMBER, result) == FROTH_OK;
+  }
+  return false;
 }
 /*------------- END OF CORE PRIMITIVES -------------*/
 
@@ -673,9 +571,12 @@ froth_error_t froth_prim_catch(froth_vm_t *froth_vm) {
 #define REPL_QUOTE_DISPLAY_MAX 8
 
 static froth_error_t emit_cell(froth_cell_t cell, froth_heap_t *heap);
+static froth_error_t emit_object(froth_cell_t cell, froth_heap_t *heap,
+                                 bool nested);
 
 /* Emit a quotation body token in display form (no angle brackets). */
 static froth_error_t emit_quote_token(froth_cell_t cell, froth_heap_t *heap) {
+  cell = froth_fuse_original(cell);
   froth_cell_t payload = FROTH_CELL_STRIP_TAG(cell);
   switch (FROTH_CELL_GET_TAG(cell)) {
   case FROTH_CALL: {
@@ -709,26 +610,99 @@ static froth_error_t emit_pattern(froth_cell_t payload, froth_heap_t *heap) {
   return emit_string("]");
 }
 
+/* An object inside another object always prints short: objects can hold
+ * themselves. */
+static froth_error_t emit_element(froth_cell_t cell, froth_heap_t *heap) {
+  if (FROTH_CELL_IS_OBJECT(cell))
+    return emit_object(cell, heap, true);
+  return emit_cell(cell, heap);
+}
+
+/* {k:v k:v} in slot order, skipping empty slots (ADR-065). */
+static froth_error_t emit_map_entries(froth_cell_t cell, froth_heap_t *heap) {
+  froth_cell_u_t offset = froth_object_offset(cell);
+  froth_cell_t *cells = froth_object_cells(heap, offset);
+  froth_cell_u_t end = froth_object_count(heap, offset);
+  bool first = true;
+
+  emit_string("{");
+  for (froth_cell_u_t i = FROTH_MAP_HEADER_CELLS; i < end; i += 2) {
+    if (cells[i] == cell)
+      continue;
+    if (!first)
+      froth_console_emit((uint8_t)' ');
+    first = false;
+    FROTH_TRY(emit_cell(cells[i], heap));
+    froth_console_emit((uint8_t)':');
+    FROTH_TRY(emit_element(cells[i + 1], heap));
+  }
+  return emit_string("}");
+}
+
+/* Emit an object as arr[a b c ...], ring[a b c ...] or map{k:v ...}, or
+ * <arr:n> when it is long or nested. */
+static froth_error_t emit_object(froth_cell_t cell, froth_heap_t *heap,
+                                 bool nested) {
+  froth_cell_u_t offset = froth_object_offset(cell);
+  if (!froth_object_in_heap(heap, offset))
+    return emit_string("<obj:?>"); /* outlived its arena (ADR-060) */
+  froth_cell_u_t length = froth_object_length(heap, offset);
+  froth_object_kind_t kind = froth_object_kind(heap, offset);
+
+  if (nested || length > REPL_QUOTE_DISPLAY_MAX) {
+    emit_string("<");
+    emit_string(froth_object_kind_name(kind));
+    emit_string(":");
+    emit_string(format_number((froth_cell_t)length));
+    return emit_string(">");
+  }
+  emit_string(froth_object_kind_name(kind));
+  if (kind == FROTH_OBJECT_MAP)
+    return emit_map_entries(cell, heap);
+  /* A ring's elements start at its oldest slot and wrap (ADR-066). */
+  froth_cell_t *cells = froth_object_cells(heap, offset);
+  froth_cell_u_t count = froth_object_count(heap, offset);
+  froth_cell_u_t at = 0;
+  if (kind == FROTH_OBJECT_RING) {
+    at = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cells[0]);
+    cells += FROTH_RING_HEADER_CELLS;
+    count -= FROTH_RING_HEADER_CELLS;
+  }
+  emit_string("[");
+  for (froth_cell_u_t i = 0; i < length; i++) {
+    if (i > 0)
+      froth_console_emit((uint8_t)' ');
+    FROTH_TRY(emit_element(cells[at], heap));
+    if (++at == count)
+      at = 0;
+  }
+  return emit_string("]");
+}
+
 static froth_error_t emit_cell(froth_cell_t cell, froth_heap_t *heap) {
   froth_cell_t payload = FROTH_CELL_STRIP_TAG(cell);
 
+  if (FROTH_CELL_IS_OBJECT(cell))
+    return emit_object(cell, heap, false);
+
   switch (FROTH_CELL_GET_TAG(cell)) {
   case FROTH_NUMBER:
     return emit_string(format_number(payload));
 
   case FROTH_QUOTE: {
-    froth_cell_t *body = froth_heap_cell_ptr(heap, payload);
-    froth_cell_t len = body[0];
+    froth_cell_u_t len = froth_body_count(heap, (froth_cell_u_t)payload);
+    froth_cell_u_t ip = 1;
     if (len > REPL_QUOTE_DISPLAY_MAX) {
       emit_string("<q:");
-      emit_string(format_number(len));
+      emit_string(format_number((froth_cell_t)len));
       return emit_string(">");
     }
     emit_string("[");
-    for (froth_cell_t i = 0; i < len; i++) {
+    for (froth_cell_u_t i = 0; i < len; i++) {
       if (i > 0)
         froth_console_emit((uint8_t)' ');
-      FROTH_TRY(emit_quote_token(body[1 + i], heap));
+      FROTH_TRY(emit_quote_token(
+          froth_body_next(heap, (froth_cell_u_t)payload, &ip), heap));
     }
     return emit_string("]");
   }
@@ -1073,9 +1047,9 @@ froth_error_t froth_prim_quote_len(froth_vm_t *vm) {
     return FROTH_ERROR_TYPE_MISMATCH;
   }
   froth_cell_t return_cell;
-  froth_cell_t *quote_location =
-      froth_heap_cell_ptr(&vm->heap, FROTH_CELL_STRIP_TAG(quote_cell));
-  FROTH_TRY(froth_make_cell(quote_location[0], FROTH_NUMBER, &return_cell));
+  froth_cell_u_t count =
+      froth_body_count(&vm->heap, FROTH_CELL_STRIP_TAG(quote_cell));
+  FROTH_TRY(froth_make_cell((froth_cell_t)count, FROTH_NUMBER, &return_cell));
 
   return froth_stack_push(&vm->ds, return_cell);
 }
@@ -1093,39 +1067,56 @@ froth_error_t froth_prim_quote_at(froth_vm_t *vm) {
   }
 
   froth_cell_t idx_val = FROTH_CELL_STRIP_TAG(idx);
-  froth_cell_t *quote_location =
-      froth_heap_cell_ptr(&vm->heap, FROTH_CELL_STRIP_TAG(quote_cell));
-  froth_cell_u_t quote_length = quote_location[0];
-  if (idx_val < 0 || idx_val >= quote_length) {
+  froth_cell_t cell;
+  if (idx_val < 0 ||
+      !froth_body_at(&vm->heap, FROTH_CELL_STRIP_TAG(quote_cell),
+                     (froth_cell_u_t)idx_val, &cell)) {
     return FROTH_ERROR_BOUNDS;
   }
 
-  if (FROTH_CELL_IS_CALL(quote_location[idx_val + 1])) {
-    FROTH_TRY(froth_make_cell(FROTH_CELL_STRIP_TAG(quote_location[idx_val + 1]),
-                              FROTH_SLOT, &return_cell));
+  cell = froth_fuse_original(cell);
+  if (FROTH_CELL_IS_CALL(cell)) {
+    FROTH_TRY(froth_make_cell(FROTH_CELL_STRIP_TAG(cell), FROTH_SLOT,
+                              &return_cell));
     return froth_stack_push(&vm->ds, return_cell);
   }
 
-  return froth_stack_push(&vm->ds, quote_location[idx_val + 1]);
+  return froth_stack_push(&vm->ds, cell);
 }
 
-froth_error_t froth_prim_mark(froth_vm_t *vm) {
-  vm->mark_offset = vm->heap.pointer;
+/* Arenas (ADR-060): arena{ records the heap pointer and the matching
+ * }arena drops everything allocated since. They nest, so library words can
+ * use them inside a caller's arena. mark and release are the same words.
+ * An arena is not tied to the word that opened it: one left open when the
+ * word returns stays open until a }arena or an unwinding catch. */
+froth_error_t froth_prim_arena_open(froth_vm_t *vm) {
+  if (vm->arenas.pointer >= vm->arenas.capacity)
+    return FROTH_ERROR_ARENA_DEPTH;
+  vm->arenas.data[vm->arenas.pointer++] = (froth_cell_t)vm->heap.pointer;
 
   return FROTH_OK;
 }
 
-froth_error_t froth_prim_release(froth_vm_t *vm) {
-  if (vm->mark_offset == (froth_cell_u_t)-1) { // No mark set
+froth_error_t froth_prim_arena_close(froth_vm_t *vm) {
+  if (vm->arenas.pointer == 0) { // No arena open
     return FROTH_ERROR_NO_MARK;
   }
 
-  vm->heap.pointer = vm->mark_offset;
-  vm->mark_offset = (froth_cell_u_t)-1;
+  froth_arena_unwind(vm, vm->arenas.pointer - 1);
 
   return FROTH_OK;
 }
 
+void froth_arena_unwind(froth_vm_t *vm, froth_cell_u_t depth) {
+  if (vm->arenas.pointer <= depth)
+    return;
+  vm->heap.pointer = (froth_cell_u_t)vm->arenas.data[depth];
+  vm->arenas.pointer = depth;
+  froth_intern_forget_from(vm->heap.pointer);
+  /* Released bodies may be rebuilt at the same offsets. */
+  froth_jit_forget();
+}
+
 froth_error_t froth_prim_see(froth_vm_t *vm) {
   froth_cell_t slot_cell;
   FROTH_TRY(froth_stack_pop(&vm->ds, &slot_cell));
@@ -1171,13 +1162,27 @@ froth_error_t froth_prim_see(froth_vm_t *vm) {
     FROTH_TRY(emit_string(" | "));
   }
   FROTH_TRY(emit_string(has_prim ? "primitive" : "user-defined"));
+#ifdef FROTH_STACK_VERIFY
+  froth_verify_slot(vm, slot_index);
+  const froth_slot_t *slot = froth_slot_entry(slot_index);
+  if (slot->verify == FROTH_VERIFY_OK) {
+    FROTH_TRY(emit_string(" | verified ( "));
+    FROTH_TRY(emit_string(format_number(slot->ds_in)));
+    FROTH_TRY(emit_string(" -- "));
+    FROTH_TRY(emit_string(format_number(slot->ds_out)));
+    FROTH_TRY(emit_string(" )"));
+  }
+#endif
   FROTH_TRY(emit_string("\n"));
   return FROTH_OK;
 }
 
 froth_error_t froth_prim_dangerous_reset(froth_vm_t *vm) {
   FROTH_TRY(froth_slot_reset_overlay());
+  froth_vocab_reset();
   vm->heap.pointer = vm->watermark_heap_offset;
+  froth_intern_forget_from(vm->watermark_heap_offset);
+  froth_mem_note_restore(0);
 
   vm->ds.pointer = 0;
   vm->rs.pointer = 0;
@@ -1187,7 +1192,7 @@ froth_error_t froth_prim_dangerous_reset(froth_vm_t *vm) {
   vm->last_error_slot = -1;
   vm->interrupted = 0;
   vm->trampoline_depth = 0;
-  vm->mark_offset = (froth_cell_u_t)-1;
+  vm->arenas.pointer = 0;
 
   froth_tbuf_init(vm);
 
@@ -1286,8 +1291,11 @@ const froth_ffi_entry_t froth_primitives[] = {
     {"q@", froth_prim_quote_at, "( q i -- cell )", "Fetch cell at index"},
 
     /* Memory */
-    {"mark", froth_prim_mark, "( -- )", "Snapshot heap pointer"},
-    {"release", froth_prim_release, "( -- )", "Restore heap to last mark"},
+    {"arena{", froth_prim_arena_open, "( -- )", "Open a heap arena"},
+    {"}arena", froth_prim_arena_close, "( -- )",
+     "Free the heap used since the matching arena{"},
+    {"mark", froth_prim_arena_open, "( -- )", "Same as arena{"},
+    {"release", froth_prim_arena_close, "( -- )", "Same as }arena"},
 
     /* Display / introspection */
     {".", froth_prim_dot, "( x -- )", "Print and consume top"},
@@ -1296,6 +1304,14 @@ const froth_ffi_entry_t froth_primitives[] = {
     {"see", froth_prim_see, "( slot -- )", "Display slot definition"},
     {"info", froth_prim_info, "( -- )", "Print system info"},
 
+    /* Vocabularies (ADR-068) */
+    {"vocab", froth_prim_vocab, "( s -- )",
+     "Define new words in vocabulary s and search it first"},
+    {"using", froth_prim_using, "( s -- )", "Search vocabulary s first"},
+    {"only", froth_prim_only, "( -- )", "Search and define in forth alone"},
+    {"vocab.words", froth_prim_vocab_words, "( s -- )",
+     "List the words of vocabulary s"},
+
     /* Reset */
     {"dangerous-reset", froth_prim_dangerous_reset, "( -- )",
      "Wipe overlay state back to stdlib baseline"},
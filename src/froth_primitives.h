@@ -2,6 +2,7 @@
 
 #include "froth_types.h"
 #include "froth_ffi.h"
+#include "froth_slot_table.h"
 
 #ifndef FROTH_MAX_PERM_SIZE
   #define FROTH_MAX_PERM_SIZE 8
@@ -14,7 +15,42 @@ froth_error_t froth_prim_rpush(froth_vm_t *froth_vm);
 froth_error_t froth_prim_rpop(froth_vm_t *froth_vm);
 froth_error_t froth_prim_rpeek(froth_vm_t *froth_vm);
 froth_error_t froth_prim_def(froth_vm_t *froth_vm);
+froth_error_t froth_prim_add(froth_vm_t *froth_vm);
+froth_error_t froth_prim_sub(froth_vm_t *froth_vm);
+froth_error_t froth_prim_compare_lt(froth_vm_t *froth_vm);
+froth_error_t froth_prim_compare_eq(froth_vm_t *froth_vm);
+froth_error_t froth_prim_compare_gt(froth_vm_t *froth_vm);
+froth_error_t froth_prim_while(froth_vm_t *froth_vm);
+froth_error_t froth_prim_catch(froth_vm_t *froth_vm);
+froth_error_t froth_prim_call(froth_vm_t *froth_vm);
+
+/* Code field for a slot bound to prim: FROTH_CODE_WHILE/CATCH/CALL for the
+ * control primitives the executor runs as CS frames (ADR-053),
+ * FROTH_CODE_PRIM otherwise. */
+froth_code_kind_t froth_prim_code(froth_native_word_t prim);
+
+/* Fast-path body of a binary number word (ADR-054): + - * < = > and or xor
+ * lshift rshift. NULL for every other prim. */
+froth_binop_t froth_prim_binop(froth_native_word_t prim);
+
+/* Run prim at build time on the literal cells that end a body (ADR-073):
+ * the binary number words above and invert, on number operands. top points
+ * past the last of available cells. On success *arity cells are replaced by
+ * *result; false leaves the call to run time. */
+bool froth_prim_fold(froth_native_word_t prim, const froth_cell_t *top,
+                     froth_cell_u_t available, froth_cell_u_t *arity,
+                     froth_cell_t *result);
 froth_error_t froth_prim_dangerous_reset(froth_vm_t *froth_vm);
+
+/* Close arenas (ADR-060) until depth remain open, dropping the heap used
+ * since the outermost one closed. No-op if depth or fewer are open. */
+void froth_arena_unwind(froth_vm_t *froth_vm, froth_cell_u_t depth);
+froth_error_t froth_prim_perm(froth_vm_t *froth_vm);
+
+/* perm with its operands already popped: pattern is [len, index...], index 0
+ * being the top of the window. Same checks and errors as perm. */
+froth_error_t froth_perm_apply(froth_vm_t *froth_vm, froth_cell_t window_size,
+                               const uint8_t *pattern);
 froth_error_t froth_prim_bstring_num_to_string(froth_vm_t *vm);
 froth_error_t froth_prim_bstring_num_to_hexs(froth_vm_t *vm);
 froth_error_t froth_prim_bstring_num_to_bins(froth_vm_t *vm);
@@ -0,0 +1,253 @@
+#ifdef FROTH_PROFILE
+
+#include "froth_profile.h"
+#include "froth_executor.h"
+#include "froth_fmt.h"
+#include "froth_slot_table.h"
+#include "platform.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/* An open call on the shadow stack. Word entries close when the CS drops
+ * their frame; explicit entries (primitives, froth_execute_slot) close when
+ * the call returns, and are never closed by a CS cut. */
+typedef struct {
+  froth_cell_u_t slot_index;
+  froth_cell_u_t cs_index;
+  uint32_t start_us;
+  uint32_t child_us; /* inclusive time of calls made from this one */
+  uint8_t is_explicit;
+} profile_frame_t;
+
+bool froth_profile_active = false;
+
+static froth_profile_counts_t counts[FROTH_SLOT_TABLE_SIZE];
+/* Open entries per slot, so recursion adds inclusive time only once. */
+static uint16_t open_count[FROTH_SLOT_TABLE_SIZE];
+
+static profile_frame_t stack[FROTH_PROFILE_DEPTH];
+static froth_cell_u_t depth = 0;
+
+static uint32_t elapsed_us = 0;
+static uint32_t started_us = 0;
+static uint32_t unattributed = 0;
+
+static void push(froth_cell_u_t slot_index, froth_cell_u_t cs_index,
+                 bool is_explicit) {
+  counts[slot_index].calls++;
+  if (depth >= FROTH_PROFILE_DEPTH)
+    return; /* counted, but not timed */
+  stack[depth++] = (profile_frame_t){slot_index, cs_index,
+                                     platform_uptime_us(), 0,
+                                     (uint8_t)is_explicit};
+  open_count[slot_index]++;
+}
+
+static void pop(uint32_t now) {
+  profile_frame_t *f = &stack[--depth];
+  uint32_t total = now - f->start_us;
+  froth_profile_counts_t *c = &counts[f->slot_index];
+  c->exclusive_us += total - f->child_us;
+  if (--open_count[f->slot_index] == 0)
+    c->inclusive_us += total;
+  if (depth > 0)
+    stack[depth - 1].child_us += total;
+}
+
+void froth_profile_enter_word(froth_cell_u_t slot_index,
+                              froth_cell_u_t cs_index) {
+  push(slot_index, cs_index, false);
+}
+
+void froth_profile_leave_frames(froth_cell_u_t cs_pointer) {
+  uint32_t now = 0;
+  bool have_now = false;
+  while (depth > 0 && !stack[depth - 1].is_explicit &&
+         stack[depth - 1].cs_index >= cs_pointer) {
+    if (!have_now) {
+      now = platform_uptime_us();
+      have_now = true;
+    }
+    pop(now);
+  }
+}
+
+/* Close everything above mark, the depth before an explicit entry. Words
+ * still open above it were left by an error that the executor has already
+ * unwound. */
+static void leave_to(froth_cell_u_t mark) {
+  if (depth <= mark)
+    return;
+  uint32_t now = platform_uptime_us();
+  while (depth > mark)
+    pop(now);
+}
+
+froth_error_t froth_profile_run_prim(froth_vm_t *vm, froth_cell_u_t slot_index,
+                                     froth_native_word_t prim) {
+  froth_cell_u_t mark = depth;
+  push(slot_index, 0, true);
+  froth_error_t err = prim(vm);
+  leave_to(mark);
+  return err;
+}
+
+froth_error_t froth_profile_run_quote(froth_vm_t *vm,
+                                      froth_cell_u_t slot_index,
+                                      froth_cell_t quote) {
+  froth_cell_u_t mark = depth;
+  push(slot_index, 0, true);
+  froth_error_t err = froth_execute_quote(vm, quote);
+  leave_to(mark);
+  return err;
+}
+
+void froth_profile_sample(void) {
+  if (!froth_profile_active)
+    return;
+  if (depth == 0) {
+    unattributed++;
+    return;
+  }
+  counts[stack[depth - 1].slot_index].samples++;
+}
+
+uint32_t froth_profile_elapsed_us(void) {
+  if (!froth_profile_active)
+    return elapsed_us;
+  return elapsed_us + (platform_uptime_us() - started_us);
+}
+
+uint32_t froth_profile_unattributed_samples(void) { return unattributed; }
+
+bool froth_profile_get(froth_cell_u_t slot_index,
+                       froth_profile_counts_t *out) {
+  if (slot_index >= FROTH_SLOT_TABLE_SIZE || counts[slot_index].calls == 0)
+    return false;
+  *out = counts[slot_index];
+  return true;
+}
+
+/* --- Words --- */
+
+static froth_error_t emit_u32(uint32_t value) {
+  char buf[12];
+  snprintf(buf, sizeof(buf), "%" PRIu32, value);
+  return emit_string(buf);
+}
+
+/* ---- prof.start ---- ( -- ) */
+static froth_error_t prim_start(froth_vm_t *vm) {
+  (void)vm;
+  if (froth_profile_active)
+    return FROTH_OK;
+  depth = 0;
+  memset(open_count, 0, sizeof(open_count));
+  started_us = platform_uptime_us();
+  froth_profile_active = true;
+  return FROTH_OK;
+}
+
+/* ---- prof.stop ---- ( -- )
+ * Closes every open entry at the current time. */
+static froth_error_t prim_stop(froth_vm_t *vm) {
+  (void)vm;
+  if (!froth_profile_active)
+    return FROTH_OK;
+  leave_to(0);
+  elapsed_us = froth_profile_elapsed_us();
+  froth_profile_active = false;
+  return FROTH_OK;
+}
+
+/* ---- prof.reset ---- ( -- )
+ * Open entries keep running and are credited to the cleared counters. */
+static froth_error_t prim_reset(froth_vm_t *vm) {
+  (void)vm;
+  memset(counts, 0, sizeof(counts));
+  unattributed = 0;
+  elapsed_us = 0;
+  started_us = platform_uptime_us();
+  return FROTH_OK;
+}
+
+/* ---- prof.report ---- ( -- )
+ * One line per called word, most exclusive time first, then the split
+ * between primitives and quotation words. */
+static froth_error_t prim_report(froth_vm_t *vm) {
+  (void)vm;
+  static bool listed[FROTH_SLOT_TABLE_SIZE];
+  froth_cell_u_t slots = froth_slot_count();
+  uint32_t prim_us = 0, quote_us = 0, prim_calls = 0, quote_calls = 0;
+
+  memset(listed, 0, sizeof(listed));
+  FROTH_TRY(emit_string("word | kind | calls | incl us | excl us | samples\n"));
+  for (;;) {
+    froth_cell_u_t best = slots;
+    for (froth_cell_u_t i = 0; i < slots; i++) {
+      if (listed[i] || counts[i].calls == 0)
+        continue;
+      if (best == slots || counts[i].exclusive_us > counts[best].exclusive_us)
+        best = i;
+    }
+    if (best == slots)
+      break;
+    listed[best] = true;
+
+    const froth_profile_counts_t *c = &counts[best];
+    const char *name;
+    if (froth_slot_get_name(best, &name) != FROTH_OK)
+      continue;
+    bool is_prim = froth_slot_entry(best)->prim != NULL;
+    if (is_prim) {
+      prim_us += c->exclusive_us;
+      prim_calls += c->calls;
+    } else {
+      quote_us += c->exclusive_us;
+      quote_calls += c->calls;
+    }
+
+    FROTH_TRY(emit_string(name));
+    FROTH_TRY(emit_string(is_prim ? " | prim | " : " | quote | "));
+    FROTH_TRY(emit_u32(c->calls));
+    FROTH_TRY(emit_string(" | "));
+    FROTH_TRY(emit_u32(c->inclusive_us));
+    FROTH_TRY(emit_string(" | "));
+    FROTH_TRY(emit_u32(c->exclusive_us));
+    FROTH_TRY(emit_string(" | "));
+    FROTH_TRY(emit_u32(c->samples));
+    FROTH_TRY(emit_string("\n"));
+  }
+
+  FROTH_TRY(emit_string("prims: "));
+  FROTH_TRY(emit_u32(prim_calls));
+  FROTH_TRY(emit_string(" calls "));
+  FROTH_TRY(emit_u32(prim_us));
+  FROTH_TRY(emit_string(" us | quotes: "));
+  FROTH_TRY(emit_u32(quote_calls));
+  FROTH_TRY(emit_string(" calls "));
+  FROTH_TRY(emit_u32(quote_us));
+  FROTH_TRY(emit_string(" us | elapsed: "));
+  FROTH_TRY(emit_u32(froth_profile_elapsed_us()));
+  FROTH_TRY(emit_string(" us | unattributed samples: "));
+  FROTH_TRY(emit_u32(unattributed));
+  FROTH_TRY(emit_string("\n"));
+  return FROTH_OK;
+}
+
+FROTH_FFI(prim_start, "prof.start", "( -- )", "Start or resume profiling");
+FROTH_FFI(prim_stop, "prof.stop", "( -- )", "Stop profiling");
+FROTH_FFI(prim_reset, "prof.reset", "( -- )", "Clear profile counters");
+FROTH_FFI(prim_report, "prof.report", "( -- )",
+          "Print calls and times per word");
+
+const froth_ffi_entry_t froth_profile_prims[] = {
+    FROTH_BIND(prim_start),
+    FROTH_BIND(prim_stop),
+    FROTH_BIND(prim_reset),
+    FROTH_BIND(prim_report),
+    {0},
+};
+
+#endif /* FROTH_PROFILE */
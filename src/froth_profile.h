@@ -0,0 +1,99 @@
+#pragma once
+
+#include "froth_ffi.h"
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Per-word profiler (ADR-058).
+ *
+ * While running, every call of a word through the executor or
+ * froth_execute_slot is counted against its slot. Its inclusive and
+ * exclusive time is measured with platform_uptime_us. Quotation words are
+ * tracked on a shadow stack keyed by their CS frame, so tail calls, catch
+ * unwinding and re-entry close them where the executor drops the frame.
+ * Each safe-point poll (ADR-052) also takes a sample of the innermost word.
+ *
+ * Compiled out, every hook below is an empty inline and
+ * FROTH_PROFILE_ACTIVE() is 0. Compiled in but stopped, each hook is one
+ * load and branch. */
+
+/* Counters for one slot. Times wrap after about 71 minutes. */
+typedef struct {
+  uint32_t calls;
+  uint32_t inclusive_us;
+  uint32_t exclusive_us;
+  uint32_t samples;
+} froth_profile_counts_t;
+
+#ifdef FROTH_PROFILE
+
+#ifndef FROTH_PROFILE_DEPTH
+#define FROTH_PROFILE_DEPTH (FROTH_CS_CAPACITY + 64)
+#endif
+
+extern bool froth_profile_active;
+/* Hooks sit on the executor's hot paths: keep their bodies out of line. */
+#ifdef __GNUC__
+#define FROTH_PROFILE_ACTIVE() __builtin_expect(froth_profile_active, 0)
+#else
+#define FROTH_PROFILE_ACTIVE() (froth_profile_active)
+#endif
+
+/* A quotation word's frame now sits at cs_index. */
+void froth_profile_enter_word(froth_cell_u_t slot_index,
+                              froth_cell_u_t cs_index);
+
+/* The CS was cut back to cs_pointer: close the words whose frames went. */
+void froth_profile_leave_frames(froth_cell_u_t cs_pointer);
+
+/* Call prim as the word in slot_index, timing it. */
+froth_error_t froth_profile_run_prim(froth_vm_t *vm, froth_cell_u_t slot_index,
+                                     froth_native_word_t prim);
+
+/* Run the quotation bound to slot_index through the trampoline, timing it
+ * as one call of that word. */
+froth_error_t froth_profile_run_quote(froth_vm_t *vm,
+                                      froth_cell_u_t slot_index,
+                                      froth_cell_t quote);
+
+/* A safe-point poll: sample the innermost word, if running. Called on
+ * every poll, so the check stays out of the executor's inlined code. */
+void froth_profile_sample(void);
+
+/* --- Readout (prof.report and the link's PROF_RES) --- */
+
+/* Microseconds profiled so far, including the current run. */
+uint32_t froth_profile_elapsed_us(void);
+
+/* Samples taken with no word on the shadow stack. */
+uint32_t froth_profile_unattributed_samples(void);
+
+/* Counters of slot_index. False if it has never been called. */
+bool froth_profile_get(froth_cell_u_t slot_index,
+                       froth_profile_counts_t *counts);
+
+extern const froth_ffi_entry_t froth_profile_prims[];
+
+#else /* !FROTH_PROFILE */
+
+#define FROTH_PROFILE_ACTIVE() 0
+
+static inline void froth_profile_enter_word(froth_cell_u_t slot_index,
+                                            froth_cell_u_t cs_index) {
+  (void)slot_index;
+  (void)cs_index;
+}
+static inline void froth_profile_leave_frames(froth_cell_u_t cs_pointer) {
+  (void)cs_pointer;
+}
+static inline froth_error_t froth_profile_run_prim(froth_vm_t *vm,
+                                                   froth_cell_u_t slot_index,
+                                                   froth_native_word_t prim) {
+  (void)slot_index;
+  return prim(vm);
+}
+static inline void froth_profile_sample(void) {}
+
+#endif /* FROTH_PROFILE */
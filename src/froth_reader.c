@@ -4,7 +4,8 @@
 /* Character classification helpers */
 
 static int is_whitespace(char c) {
-  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  // A NUL byte inside a chunk separates tokens like a space
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\0';
 }
 
 static int is_digit(char c) {
@@ -15,11 +16,51 @@ static int is_delimiter(char c) {
   return c == '[' || c == ']' || c == ';' || c == '(' || c == ')' || c == '"' || c == '\'' || c == '\0' || is_whitespace(c);
 }
 
+/* The character at position i, or '\0' past the end of the chunk. */
+static char char_at(const froth_reader_t* reader, froth_cell_u_t i) {
+  return i < reader->length ? reader->input[i] : '\0';
+}
+
+/* True when a token that runs to the reader's position may go on in the
+ * next chunk. */
+static bool cut_off(const froth_reader_t* reader) {
+  return !reader->final && reader->position >= reader->length;
+}
+
 /* Skip past whitespace and comments. A backslash (\) starts a line comment
- * that runs to end-of-input. After this call, reader->position points at
- * the next meaningful character or the null terminator. */
+ * that runs to end of line. A comment still open at the end of a chunk that
+ * is not final stays open into the next one. After this call,
+ * reader->position points at the next meaningful character or the end of
+ * the chunk. */
 static froth_error_t skip_whitespace_and_comments(froth_reader_t* reader) {
-  while (reader->input[reader->position] != '\0') {
+  for (;;) {
+    // Line comment: \ to end of line
+    if (reader->line_comment) {
+      while (reader->position < reader->length &&
+             reader->input[reader->position] != '\n') {
+        reader->position++;
+      }
+      if (reader->position >= reader->length) { break; }
+      reader->line_comment = false;
+      continue;
+    }
+
+    // Paren comment: ( to matching ), with nesting
+    if (reader->comment_depth > 0) {
+      while (reader->position < reader->length && reader->comment_depth > 0) {
+        char c = reader->input[reader->position];
+        if (c == '(') { reader->comment_depth++; }
+        else if (c == ')') { reader->comment_depth--; }
+        reader->position++;
+      }
+      if (reader->comment_depth > 0) {
+        if (reader->final) { return FROTH_ERROR_UNTERMINATED_COMMENT; }
+        break;
+      }
+      continue;
+    }
+
+    if (reader->position >= reader->length) { break; }
     char c = reader->input[reader->position];
 
     if (is_whitespace(c)) {
@@ -27,27 +68,15 @@ static froth_error_t skip_whitespace_and_comments(froth_reader_t* reader) {
       continue;
     }
 
-    // Line comment: \ to end of line
     if (c == '\\') {
-      while (reader->input[reader->position] != '\0' &&
-             reader->input[reader->position] != '\n') {
-        reader->position++;
-      }
+      reader->line_comment = true;
+      reader->position++;
       continue;
     }
 
-    // Paren comment: ( to matching ), with nesting
     if (c == '(') {
-      int depth = 1;
+      reader->comment_depth = 1;
       reader->position++;
-      while (reader->input[reader->position] != '\0' && depth > 0) {
-        if (reader->input[reader->position] == '(') { depth++; }
-        else if (reader->input[reader->position] == ')') { depth--; }
-        reader->position++;
-      }
-      if (depth > 0) {
-        return FROTH_ERROR_UNTERMINATED_COMMENT;
-      }
       continue;
     }
 
@@ -61,53 +90,44 @@ static froth_error_t skip_whitespace_and_comments(froth_reader_t* reader) {
   return FROTH_OK;
 }
 
-/* Peek into the next character without advancing the reader. peek(0) returns the current character, peek(1)
- * returns the next character, etc. Returns '\0' if peeking past the end of input. */
-static char froth_reader_peek(froth_reader_t* reader, froth_cell_u_t peek_ahead) {
-  for (int i = 0; i <= peek_ahead; i++) {
-     if (reader->input[reader->position + i] == '\0') {
-       return '\0';
-     }
-  }
-  return reader->input[reader->position + peek_ahead];
-}
+/* Scan a contiguous word (non-whitespace, non-delimiter characters) and
+ * return its length. Returns FROTH_ERROR_TOKEN_TOO_LONG if the word exceeds
+ * FROTH_TOKEN_NAME_MAX - 1 characters, the longest name a slot can take. */
+static froth_error_t scan_word(froth_reader_t* reader, froth_cell_u_t* out_len) {
+  froth_cell_u_t start = reader->position;
 
-/* Read a contiguous word (non-whitespace, non-delimiter characters) into
- * the provided buffer. Returns FROTH_ERROR_TOKEN_TOO_LONG if the word
- * exceeds max_len - 1 characters. The buffer is always null-terminated. */
-static froth_error_t read_word(froth_reader_t* reader, char* buf, froth_cell_u_t max_len) {
-  froth_cell_u_t len = 0;
-
-  while (!is_delimiter(reader->input[reader->position])) {
-    if (len >= max_len - 1) { return FROTH_ERROR_TOKEN_TOO_LONG; }
-    buf[len++] = reader->input[reader->position++];
+  while (!is_delimiter(char_at(reader, reader->position))) {
+    if (reader->position - start >= FROTH_TOKEN_NAME_MAX - 1) { return FROTH_ERROR_TOKEN_TOO_LONG; }
+    reader->position++;
   }
 
-  buf[len] = '\0';
+  *out_len = reader->position - start;
   return FROTH_OK;
 }
 
-/* Try to parse a word as an integer. Returns 1 on success, 0 if the word
- * is not a valid integer. Handles optional leading '-' but only if followed
- * by at least one digit ("-" alone is an identifier, not a number). */
-static int try_parse_number(const char* word, froth_cell_t* result) {
+/* Try to parse a word of len characters as an integer. Returns 1 on success,
+ * 0 if the word is not a valid integer. Handles optional leading '-' but
+ * only if followed by at least one digit ("-" alone is an identifier, not a
+ * number). */
+static int try_parse_number(const char* word, froth_cell_u_t len, froth_cell_t* result) {
   const char* p = word;
+  const char* end = word + len;
   int negative = 0;
   froth_cell_t value = 0;
 
-  if (*p == '-') {
+  if (p < end && *p == '-') {
     negative = 1;
     p++;
-    if (!is_digit(*p)) { return 0; } // bare "-" is an identifier
+    if (p == end || !is_digit(*p)) { return 0; } // bare "-" is an identifier
   }
 
-  if (!is_digit(*p)) { return 0; }
+  if (p == end || !is_digit(*p)) { return 0; }
 
-  if (*p == '0' && p[1] == 'x') { // Number is a hex
+  if (*p == '0' && end - p > 1 && p[1] == 'x') { // Number is a hex
     p += 2; // Skip "0x"
-    if (*p == '\0') { return 0; } // "0x" followed by whitespace or end of input is an identifier
+    if (p == end) { return 0; } // "0x" followed by whitespace or end of input is an identifier
     // Parse hex string into number
-    while (*p != '\0') {
+    while (p < end) {
       if (is_digit(*p)) {
         value = (value << 4) | (*p - '0');
       } else if (*p >= 'a' && *p <= 'f') {
@@ -119,11 +139,11 @@ static int try_parse_number(const char* word, froth_cell_t* result) {
       }
       p++;
     }
-  } else if (*p == '0' && p[1] == 'b') { // Number is a binary
+  } else if (*p == '0' && end - p > 1 && p[1] == 'b') { // Number is a binary
     p += 2; // Skip "0b"
-    if (*p == '\0') { return 0; } // "0b" followed by whitespace or end of input is an identifier
+    if (p == end) { return 0; } // "0b" followed by whitespace or end of input is an identifier
     // Parse binary string into number
-    while (*p != '\0') {
+    while (p < end) {
       if (*p == '0' || *p == '1') {
         value = (value << 1) | (*p - '0');
       } else {
@@ -132,72 +152,123 @@ static int try_parse_number(const char* word, froth_cell_t* result) {
       p++;
     }
   } else { // Number is a base 10
-    while (is_digit(*p)) {
+    while (p < end && is_digit(*p)) {
       value = value * 10 + (*p - '0');
       p++;
     }
   }
 
   // If there are trailing non-digit characters, it's an identifier (e.g. "3foo")
-  if (*p != '\0') { return 0; }
+  if (p != end) { return 0; }
 
   *result = negative ? -value : value;
   return 1;
 }
 
-/* Scan a string body after the opening '"' has been consumed.
- * Resolves escape sequences (\n, \t, \r, \\, \") into raw bytes.
- * Unknown escapes are a reader error. */
-static froth_error_t read_string(froth_reader_t* reader, uint8_t* buf, froth_cell_u_t* out_len) {
+/* Decode one escape character (the one after the backslash). Returns -1
+ * for an unknown escape. */
+static int escape_byte(char c) {
+  switch (c) {
+  case '\\': return '\\';
+  case '"':  return '"';
+  case 'n':  return '\n';
+  case 'r':  return '\r';
+  case 't':  return '\t';
+  default:   return -1;
+  }
+}
+
+/* Scan a string body after the opening '"' has been consumed. Checks the
+ * escape sequences (\n, \t, \r, \\, \") and counts the decoded length, but
+ * leaves decoding to froth_reader_decode_string. Unknown escapes are a
+ * reader error. Sets *cut if the chunk ends inside the string and more
+ * input may follow. */
+static froth_error_t scan_string(froth_reader_t* reader, froth_token_t* token, bool* cut) {
+  froth_cell_u_t start = reader->position;
   froth_cell_u_t len = 0;
 
   while (1) {
+    if (reader->position >= reader->length) { break; }
     char c = reader->input[reader->position];
-    if (c == '\0') { return FROTH_ERROR_UNTERMINATED_STRING; }
-    if (c == '"') { reader->position++; break; }
+    if (c == '"') { break; }
     if (len >= FROTH_STRING_MAX_LEN) { return FROTH_ERROR_BSTRING_TOO_LONG; }
 
     if (c == '\\') {
       reader->position++;
+      if (reader->position >= reader->length) { break; }
       c = reader->input[reader->position];
-      if (c == '\0') { return FROTH_ERROR_UNTERMINATED_STRING; }
-      if      (c == '\\') { buf[len++] = '\\'; }
-      else if (c == '"')  { buf[len++] = '"'; }
-      else if (c == 'n')  { buf[len++] = '\n'; }
-      else if (c == 'r')  { buf[len++] = '\r'; }
-      else if (c == 't')  { buf[len++] = '\t'; }
-      else { return FROTH_ERROR_INVALID_ESCAPE; }
-      reader->position++;
-      continue;
+      if (escape_byte(c) < 0) { return FROTH_ERROR_INVALID_ESCAPE; }
     }
 
-    buf[len++] = c;
+    len++;
     reader->position++;
   }
 
-  *out_len = len;
+  if (reader->position >= reader->length) {
+    if (reader->final) { return FROTH_ERROR_UNTERMINATED_STRING; }
+    *cut = true;
+    return FROTH_OK;
+  }
+
+  token->text = reader->input + start;
+  token->length = reader->position - start;
+  token->bstring_len = len;
+  reader->position++; // skip the closing quote
   return FROTH_OK;
 }
 
+void froth_reader_decode_string(const froth_token_t* token, uint8_t* out) {
+  // Without escapes the body is already the decoded string.
+  if (token->bstring_len == token->length) {
+    memcpy(out, token->text, token->length);
+    return;
+  }
+
+  for (froth_cell_u_t i = 0; i < token->length; i++) {
+    char c = token->text[i];
+    *out++ = (uint8_t)(c == '\\' ? escape_byte(token->text[++i]) : c);
+  }
+}
+
 void froth_reader_init(froth_reader_t* reader, const char* input) {
+  reader->comment_depth = 0;
+  reader->line_comment = false;
+  froth_reader_feed(reader, input, strlen(input), true);
+}
+
+void froth_reader_feed(froth_reader_t* reader, const char* input, froth_cell_u_t length, bool final) {
   reader->input = input;
+  reader->length = length;
   reader->position = 0;
+  reader->final = final;
+}
+
+/* Leave a token that the chunk cut off for the next chunk: rewind to its
+ * first byte and report the end of this chunk. */
+static froth_error_t stop_at(froth_reader_t* reader, froth_cell_u_t start, froth_token_t* token) {
+  reader->position = start;
+  token->type = FROTH_TOKEN_EOF;
+  return FROTH_OK;
 }
 
 froth_error_t froth_reader_next_token(froth_reader_t* reader, froth_token_t* token) {
   FROTH_TRY(skip_whitespace_and_comments(reader));
 
-  char c = reader->input[reader->position];
+  froth_cell_u_t start = reader->position;
 
   // End of input
-  if (c == '\0') {
+  if (start >= reader->length) {
     token->type = FROTH_TOKEN_EOF;
     return FROTH_OK;
   }
 
+  char c = reader->input[start];
+
   if (c == '"') {
+    bool cut = false;
     reader->position++; // skip the opening quote
-    FROTH_TRY(read_string(reader, token->bstring_bytes, &token->bstring_len));
+    FROTH_TRY(scan_string(reader, token, &cut));
+    if (cut) { return stop_at(reader, start, token); }
     token->type = FROTH_TOKEN_BSTRING;
     return FROTH_OK;
   }
@@ -209,7 +280,7 @@ froth_error_t froth_reader_next_token(froth_reader_t* reader, froth_token_t* tok
     return FROTH_OK;
   }
 
-  if (c == 'p' && froth_reader_peek(reader, 1) == '[') {
+  if (c == 'p' && char_at(reader, start + 1) == '[') {
     token->type = FROTH_TOKEN_OPEN_PAT;
     reader->position += 2; // skip both 'p' and '['
     return FROTH_OK;
@@ -225,24 +296,28 @@ froth_error_t froth_reader_next_token(froth_reader_t* reader, froth_token_t* tok
   // Tick-quoted identifier
   if (c == '\'') {
     reader->position++; // skip the tick
-    froth_error_t err = read_word(reader, token->name, FROTH_TOKEN_NAME_MAX);
-    if (err != FROTH_OK) { return err; }
+    token->text = reader->input + reader->position;
+    FROTH_TRY(scan_word(reader, &token->length));
+    if (cut_off(reader)) { return stop_at(reader, start, token); }
     token->type = FROTH_TOKEN_TICK_IDENTIFIER;
     return FROTH_OK;
   }
 
-  // Word: could be a number or an identifier
-  char word[FROTH_TOKEN_NAME_MAX];
-  froth_error_t err = read_word(reader, word, FROTH_TOKEN_NAME_MAX);
-  if (err != FROTH_OK) { return err; }
+  // Word: could be a number or an identifier. One that reaches the end of
+  // the chunk may go on in the next, "p" included.
+  const char* word = reader->input + start;
+  froth_cell_u_t len;
+  FROTH_TRY(scan_word(reader, &len));
+  if (cut_off(reader)) { return stop_at(reader, start, token); }
 
   froth_cell_t number;
-  if (try_parse_number(word, &number)) {
+  if (try_parse_number(word, len, &number)) {
     token->type = FROTH_TOKEN_NUMBER;
     token->number = number;
   } else {
     token->type = FROTH_TOKEN_IDENTIFIER;
-    memcpy(token->name, word, strlen(word) + 1);
+    token->text = word;
+    token->length = len;
   }
 
   return FROTH_OK;
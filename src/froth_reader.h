@@ -1,6 +1,7 @@
 #pragma once
 
 #include "froth_types.h"
+#include <stdbool.h>
 
 #define FROTH_TOKEN_NAME_MAX 32
 
@@ -15,26 +16,45 @@ typedef enum {
   FROTH_TOKEN_EOF,              // No more tokens in the input
 } froth_token_type_t;
 
-/* A single token produced by the reader.
- * Carries either a numeric value or a name string, depending on type. */
+/* A single token produced by the reader. Names and strings are views into
+ * the input, which must outlive the token; nothing is copied. */
 typedef struct {
   froth_token_type_t type;
   union {
     froth_cell_t number;              // Valid when type == FROTH_TOKEN_NUMBER
-    char name[FROTH_TOKEN_NAME_MAX];  // Valid when type == IDENTIFIER or TICK_IDENTIFIER
-    struct {                          // Valid when type == FROTH_TOKEN_BSTRING
-      froth_cell_u_t bstring_len;
-      uint8_t bstring_bytes[FROTH_STRING_MAX_LEN];
+    struct {                          // Valid for IDENTIFIER, TICK_IDENTIFIER and BSTRING
+      const char* text;               // The name, or a string body with its escapes undecoded
+      froth_cell_u_t length;          // Bytes at text
+      froth_cell_u_t bstring_len;     // BSTRING only: length after decoding escapes
     };
   };
 } froth_token_t;
 
-/* Reader state. Tracks position within a line of input.
+/* Reader state. Tracks position within a chunk of input, and the comment
+ * state that carries from one chunk to the next (ADR-072).
  * Initialize with froth_reader_init before calling froth_reader_next_token. */
 typedef struct {
-  const char* input;      // The input string being tokenized (not owned)
-  froth_cell_u_t position; // Current read position within input
+  const char* input;             // The chunk being tokenized (not owned)
+  froth_cell_u_t length;         // Bytes at input
+  froth_cell_u_t position;       // Current read position within input
+  bool final;                    // No chunk follows this one
+  froth_cell_u_t comment_depth;  // Open paren comments
+  bool line_comment;             // Inside a \ comment
 } froth_reader_t;
 
+/* Read a whole NUL-terminated input as one final chunk. */
 void froth_reader_init(froth_reader_t* reader, const char* input);
+
+/* Go on reading from the next chunk of the same source. Comment state
+ * carries over. */
+void froth_reader_feed(froth_reader_t* reader, const char* input, froth_cell_u_t length, bool final);
+
+/* Return the next token. At the end of a chunk that is not final, a token
+ * the end may have cut off is not returned: the reader stops at its first
+ * byte and reports FROTH_TOKEN_EOF, so position < length marks the bytes
+ * the caller keeps for the next chunk. */
 froth_error_t froth_reader_next_token(froth_reader_t* reader, froth_token_t* token);
+
+/* Write the decoded bytes of a BSTRING token (bstring_len of them) to out.
+ * The reader has already checked the escapes, so this cannot fail. */
+void froth_reader_decode_string(const froth_token_t* token, uint8_t* out);
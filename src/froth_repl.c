@@ -8,10 +8,19 @@
 #include "platform.h"
 #include <stdbool.h>
 
+/* The line being typed. Each line goes to repl_stream (ADR-072), which
+ * carries an unfinished expression over to the next line. A line longer
+ * than the buffer goes in pieces. */
 static char repl_buffer[FROTH_LINE_BUFFER_SIZE];
 static froth_cell_u_t buf_pos = 0;
-static froth_cell_u_t line_start = 0;
-static int bracket_depth = 0, paren_depth = 0, in_string = 0;
+static froth_eval_stream_t repl_stream;
+static char repl_pending[FROTH_EVAL_PENDING_SIZE];
+static bool line_started = false;      // part of this line went to the stream
+static froth_error_t line_error = FROTH_OK; // drops the rest of this line
+/* Stack depths before the expression in progress, restored on error. */
+static bool expr_open = false;
+static froth_cell_u_t ds_snapshot, rs_snapshot;
+static const char *prompt_normal = "froth> ";
 static const char *prompt_cont = ".. ";
 
 /* Return a human-readable name for an error code. */
@@ -64,6 +73,10 @@ static const char *error_name(froth_error_t err) {
     return "transient string expired";
   case FROTH_ERROR_TRANSIENT_FULL:
     return "transient string buffer full";
+  case FROTH_ERROR_ARENA_DEPTH:
+    return "too many nested arenas";
+  case FROTH_ERROR_KEY_NOT_FOUND:
+    return "key not found";
   /* Reader/evaluator errors */
   case FROTH_ERROR_TOKEN_TOO_LONG:
     return "token too long";
@@ -81,6 +94,10 @@ static const char *error_name(froth_error_t err) {
     return "invalid escape sequence";
   case FROTH_ERROR_UNEXPECTED_BRACKET:
     return "unexpected ]";
+  case FROTH_ERROR_QUOTE_TOO_LARGE:
+    return "quotation too large for the data stack";
+  case FROTH_ERROR_QUOTE_TOO_DEEP:
+    return "quotations nested too deep";
   /* Snapshot errors */
   case FROTH_ERROR_SNAPSHOT_OVERFLOW:
     return "snapshot buffer overflow";
@@ -121,222 +138,115 @@ static const char *error_name(froth_error_t err) {
   }
 }
 
-/* Return true if the buffer contains only whitespace or is empty. */
-static bool is_blank(const char *str) {
-  for (const char *p = str; *p != '\0'; p++) {
-    if (*p != ' ' && *p != '\t' && *p != '\r') {
+/* Return true if the line contains only whitespace or is empty. */
+static bool is_blank(const char *str, froth_cell_u_t len) {
+  for (froth_cell_u_t i = 0; i < len; i++) {
+    if (str[i] != ' ' && str[i] != '\t' && str[i] != '\r' && str[i] != '\n') {
       return false;
     }
   }
   return true;
 }
 
-/* ── Depth scanner ─────────────────────────────────────────────────────
- * Lightweight pre-scan of raw text to decide whether an expression is
- * complete.  Tracks bracket nesting (including `:` sugar), paren-comment
- * nesting, and unclosed string literals.  State carries across lines so
- * only the newly appended portion needs to be scanned each time.       */
+/* ── REPL public interface ─────────────────────────────────────────── */
 
-static int is_scan_delimiter(char c) {
-  return c == '[' || c == ']' || c == ';' || c == '(' || c == ')' || c == '"' ||
-         c == '\'' || c == '\0' || c == ' ' || c == '\t' || c == '\r' ||
-         c == '\n';
+froth_error_t froth_repl_init(froth_vm_t *vm) {
+  (void)vm;
+  buf_pos = 0;
+  line_started = false;
+  line_error = FROTH_OK;
+  expr_open = false;
+  froth_eval_stream_init(&repl_stream, repl_pending, sizeof(repl_pending));
+  return FROTH_OK;
 }
 
-static void scan_line_depth(const char *text, int *bracket_depth,
-                            int *paren_depth, int *in_string) {
-  int i = 0;
-
-  while (text[i] != '\0') {
-    /* Inside an unclosed string from a previous line */
-    if (*in_string) {
-      if (text[i] == '\\' && text[i + 1] != '\0') {
-        i += 2;
-        continue;
-      }
-      if (text[i] == '"') {
-        *in_string = 0;
-        i++;
-        continue;
-      }
-      i++;
-      continue;
-    }
-
-    /* Inside an unclosed paren comment from a previous line */
-    if (*paren_depth > 0) {
-      if (text[i] == '(') {
-        (*paren_depth)++;
-      } else if (text[i] == ')') {
-        (*paren_depth)--;
-      }
-      i++;
-      continue;
-    }
-
-    char c = text[i];
-
-    if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
-      i++;
-      continue;
-    }
-
-    /* Line comment — skip to newline or end */
-    if (c == '\\') {
-      while (text[i] != '\0' && text[i] != '\n') {
-        i++;
-      }
-      continue;
-    }
-
-    /* Paren comment */
-    if (c == '(') {
-      *paren_depth = 1;
-      i++;
-      while (text[i] != '\0' && *paren_depth > 0) {
-        if (text[i] == '(') {
-          (*paren_depth)++;
-        } else if (text[i] == ')') {
-          (*paren_depth)--;
-        }
-        i++;
-      }
-      continue;
-    }
-
-    /* String literal */
-    if (c == '"') {
-      i++;
-      int closed = 0;
-      while (text[i] != '\0') {
-        if (text[i] == '\\' && text[i + 1] != '\0') {
-          i += 2;
-          continue;
-        }
-        if (text[i] == '"') {
-          i++;
-          closed = 1;
-          break;
-        }
-        i++;
-      }
-      if (!closed) {
-        *in_string = 1;
-      }
-      continue;
-    }
-
-    /* Brackets */
-    if (c == '[') {
-      (*bracket_depth)++;
-      i++;
-      continue;
-    }
-    if (c == ']' || c == ';') {
-      (*bracket_depth)--;
-      i++;
-      continue;
-    }
+int froth_repl_is_idle(void) {
+  return buf_pos == 0 && !line_started &&
+         froth_eval_stream_idle(&repl_stream);
+}
 
-    /* Tick — skip the quoted word, it doesn't affect depth */
-    if (c == '\'') {
-      i++;
-      while (text[i] != '\0' && !is_scan_delimiter(text[i])) {
-        i++;
-      }
-      continue;
-    }
+froth_error_t froth_repl_prompt(void) {
+  return emit_string(froth_repl_is_idle() ? prompt_normal : prompt_cont);
+}
 
-    /* Regular word — check for `:` colon-sugar opener */
-    int word_start = i;
-    while (text[i] != '\0' && !is_scan_delimiter(text[i])) {
-      i++;
-    }
-    if (i - word_start == 1 && text[word_start] == ':') {
-      (*bracket_depth)++;
+static void report_error(froth_vm_t *vm, froth_error_t err) {
+  froth_cell_t code =
+      (err == FROTH_ERROR_THROW) ? vm->thrown : (froth_cell_t)err;
+
+  emit_string("error(");
+  emit_string(format_number(code));
+  emit_string("): ");
+  emit_string(error_name((froth_error_t)code));
+  if (vm->last_error_slot >= 0) {
+    const char *name;
+    if (froth_slot_get_name((froth_cell_u_t)vm->last_error_slot, &name) ==
+        FROTH_OK) {
+      emit_string(" in \"");
+      emit_string(name);
+      emit_string("\"");
     }
   }
+  emit_string("\n");
 }
 
-/* ── REPL public interface ─────────────────────────────────────────── */
-
-static void reset_state(void) {
+/* Evaluate the first len bytes of the buffer. After an error the stacks
+ * return to where the expression began, and the rest of the line is
+ * dropped. */
+static void repl_feed(froth_vm_t *vm, froth_cell_u_t len) {
   buf_pos = 0;
-  line_start = 0;
-  bracket_depth = 0;
-  paren_depth = 0;
-  in_string = 0;
-}
-
-froth_error_t froth_repl_init(froth_vm_t *vm) {
-  (void)vm;
-  for (int i = 0; i < FROTH_LINE_BUFFER_SIZE; i++) {
-    repl_buffer[i] = '\0';
+  if (line_error != FROTH_OK)
+    return;
+  if (!expr_open) {
+    ds_snapshot = vm->ds.pointer;
+    rs_snapshot = vm->rs.pointer;
+    vm->last_error_slot = -1;
+    expr_open = true;
   }
-  reset_state();
-  return FROTH_OK;
-}
 
-int froth_repl_is_idle(void) {
-  return buf_pos == 0 && line_start == 0 && bracket_depth == 0 &&
-         paren_depth == 0 && in_string == 0;
+  froth_error_t err = froth_eval_stream_feed(&repl_stream, repl_buffer, len, vm);
+  if (err == FROTH_OK)
+    return;
+  line_error = err;
+  expr_open = false;
+  if (err == FROTH_ERROR_RESET) {
+    emit_string("reset\n");
+    return;
+  }
+  report_error(vm, err);
+  vm->ds.pointer = ds_snapshot;
+  vm->rs.pointer = rs_snapshot;
 }
 
 froth_error_t froth_repl_evaluate(froth_vm_t *vm) {
-  if (!is_blank(repl_buffer)) {
-    froth_cell_u_t ds_snapshot = vm->ds.pointer;
-    froth_cell_u_t rs_snapshot = vm->rs.pointer;
-
-    vm->last_error_slot = -1;
-    froth_error_t err = froth_evaluate_input(repl_buffer, vm);
-    if (err == FROTH_ERROR_RESET) {
-      emit_string("reset\n");
-      reset_state();
-      return FROTH_OK;
-    }
-    if (err != FROTH_OK) {
-      froth_cell_t code =
-          (err == FROTH_ERROR_THROW) ? vm->thrown : (froth_cell_t)err;
-
-      emit_string("error(");
-      emit_string(format_number(code));
-      emit_string("): ");
-      emit_string(error_name((froth_error_t)code));
-      if (vm->last_error_slot >= 0) {
-        const char *name;
-        if (froth_slot_get_name((froth_cell_u_t)vm->last_error_slot, &name) ==
-            FROTH_OK) {
-          emit_string(" in \"");
-          emit_string(name);
-          emit_string("\"");
-        }
-      }
-      emit_string("\n");
+  froth_cell_u_t len = buf_pos;
+  froth_error_t err;
 
-      vm->ds.pointer = ds_snapshot;
-      vm->rs.pointer = rs_snapshot;
-    }
-    FROTH_TRY(froth_prim_dots(vm));
+  repl_buffer[len++] = '\n';
+  if (!line_started && froth_eval_stream_idle(&repl_stream) &&
+      is_blank(repl_buffer, len)) {
+    buf_pos = 0;
+    return FROTH_OK;
   }
 
-  reset_state();
-  return FROTH_OK;
+  repl_feed(vm, len);
+  err = line_error;
+  line_started = false;
+  line_error = FROTH_OK;
+  if (err == FROTH_OK && !froth_eval_stream_idle(&repl_stream))
+    return FROTH_OK; // the expression goes on at the next line
+  expr_open = false;
+  if (err == FROTH_ERROR_RESET)
+    return FROTH_OK;
+  return froth_prim_dots(vm);
 }
 
 froth_error_t froth_repl_accept_byte(froth_vm_t *vm, char byte, int8_t *state) {
-  (void)vm;
-
-  if (buf_pos >= FROTH_LINE_BUFFER_SIZE - 1) {
-    *state = -1;
-    return FROTH_ERROR_BOUNDS;
-  }
-
   if (byte == 0x04) {
     return FROTH_ERROR_IO;
   }
 
   if (byte == '\b' || byte == 127) {
-    if (buf_pos > line_start) {
+    if (buf_pos > 0) {
       buf_pos--;
       FROTH_TRY(froth_console_emit('\b'));
       FROTH_TRY(froth_console_emit(' '));
@@ -348,24 +258,16 @@ froth_error_t froth_repl_accept_byte(froth_vm_t *vm, char byte, int8_t *state) {
 
   if (byte == '\n') {
     FROTH_TRY(froth_console_emit('\n'));
-    repl_buffer[buf_pos] = '\0';
-
-    scan_line_depth(repl_buffer + line_start, &bracket_depth, &paren_depth,
-                    &in_string);
-
-    if (bracket_depth > 0 || paren_depth > 0 || in_string) {
-      repl_buffer[buf_pos++] = '\n';
-      line_start = buf_pos;
-      FROTH_TRY(emit_string(prompt_cont));
-      *state = 0;
-      return FROTH_OK;
-    }
-
     *state = 1;
     return FROTH_OK;
   }
 
-  /* Regular byte */
+  /* Regular byte. A full buffer goes to the stream first, keeping the last
+   * byte free for the newline. */
+  if (buf_pos == FROTH_LINE_BUFFER_SIZE - 1) {
+    line_started = true;
+    repl_feed(vm, buf_pos);
+  }
   repl_buffer[buf_pos++] = byte;
   froth_console_emit(byte);
   *state = 0;
@@ -374,12 +276,11 @@ froth_error_t froth_repl_accept_byte(froth_vm_t *vm, char byte, int8_t *state) {
 
 /* Blocking REPL loop for targets without the console mux. */
 froth_error_t froth_repl_start(froth_vm_t *vm) {
-  static const char *prompt = "froth> ";
   int8_t state;
   int last_was_cr = 0;
 
   FROTH_TRY(froth_repl_init(vm));
-  FROTH_TRY(emit_string(prompt));
+  FROTH_TRY(froth_repl_prompt());
 
   while (1) {
     uint8_t byte;
@@ -419,7 +320,7 @@ froth_error_t froth_repl_start(froth_vm_t *vm) {
 
     if (state == 1) {
       FROTH_TRY(froth_repl_evaluate(vm));
-      FROTH_TRY(emit_string(prompt));
+      FROTH_TRY(froth_repl_prompt());
     }
   }
 }
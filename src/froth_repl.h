@@ -7,6 +7,8 @@
 
 froth_error_t froth_repl_init(froth_vm_t *vm);
 froth_error_t froth_repl_evaluate(froth_vm_t *vm);
+/* Emit "froth> ", or ".. " while an expression goes on over lines. */
+froth_error_t froth_repl_prompt(void);
 froth_error_t froth_repl_accept_byte(froth_vm_t *vm, char byte, int8_t *state);
 froth_error_t froth_repl_start(froth_vm_t *vm);
 int froth_repl_is_idle(void);
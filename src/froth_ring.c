@@ -0,0 +1,232 @@
+#ifdef FROTH_RINGS
+
+#include "froth_object.h"
+#include "froth_stack.h"
+#include "froth_tbuf.h"
+
+/* Ring buffers (ADR-066). A ring holds the last `capacity` values pushed:
+ * a push into a full ring drops the oldest. The layout is described in
+ * froth_object.h. */
+
+typedef struct {
+  froth_cell_t *header;   /* [start][length] */
+  froth_cell_t *elements; /* capacity slots */
+  froth_cell_u_t capacity;
+  froth_cell_u_t start;
+  froth_cell_u_t length;
+} ring_t;
+
+static froth_error_t pop_ring(froth_vm_t *vm, ring_t *ring) {
+  froth_cell_u_t offset;
+
+  FROTH_TRY(froth_object_pop(vm, FROTH_OBJECT_RING, &offset));
+  ring->header = froth_object_cells(&vm->heap, offset);
+  ring->elements = ring->header + FROTH_RING_HEADER_CELLS;
+  ring->capacity = froth_object_count(&vm->heap, offset) -
+                   FROTH_RING_HEADER_CELLS;
+  ring->start = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(ring->header[0]);
+  ring->length = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(ring->header[1]);
+  return FROTH_OK;
+}
+
+static void ring_store_header(ring_t *ring) {
+  ring->header[0] = FROTH_CELL_PACK_TAG((froth_cell_t)ring->start,
+                                        FROTH_NUMBER);
+  ring->header[1] = FROTH_CELL_PACK_TAG((froth_cell_t)ring->length,
+                                        FROTH_NUMBER);
+}
+
+/* Pop a ring whose elements are all numbers. The aggregates read the
+ * window through this. */
+static froth_error_t pop_numbers(froth_vm_t *vm, ring_t *ring) {
+  FROTH_TRY(pop_ring(vm, ring));
+  for (froth_cell_u_t i = 0, at = ring->start; i < ring->length; i++) {
+    if (!FROTH_CELL_IS_NUMBER(ring->elements[at]))
+      return FROTH_ERROR_TYPE_MISMATCH;
+    if (++at == ring->capacity)
+      at = 0;
+  }
+  return FROTH_OK;
+}
+
+/* ---- ring.new ---- ( n -- ring ) */
+static froth_error_t prim_new(froth_vm_t *vm) {
+  froth_cell_t n;
+  froth_cell_u_t offset;
+
+  FROTH_TRY(froth_pop(vm, &n));
+  if (n < 1)
+    return FROTH_ERROR_BOUNDS;
+  if ((froth_cell_u_t)n > FROTH_HEAP_SIZE / sizeof(froth_cell_t))
+    return FROTH_ERROR_HEAP_OUT_OF_MEMORY;
+  FROTH_TRY(froth_object_allocate(&vm->heap, FROTH_OBJECT_RING,
+                                  FROTH_RING_HEADER_CELLS +
+                                      (froth_cell_u_t)n,
+                                  &offset));
+  return froth_stack_push(&vm->ds, froth_object_cell(offset));
+}
+
+/* ---- ring.push ---- ( x ring -- )
+ * A full ring drops its oldest element. Transient strings are promoted, as
+ * def does. */
+static froth_error_t prim_push(froth_vm_t *vm) {
+  froth_cell_t x;
+  ring_t ring;
+
+  FROTH_TRY(pop_ring(vm, &ring));
+  FROTH_TRY(froth_stack_pop(&vm->ds, &x));
+  if (FROTH_CELL_IS_BSTRING(x) &&
+      FROTH_BSTRING_IS_TRANSIENT(FROTH_CELL_STRIP_TAG(x)))
+    FROTH_TRY(froth_bstring_promote(vm, x, &x));
+
+  froth_cell_u_t end = ring.start + ring.length;
+  if (end >= ring.capacity)
+    end -= ring.capacity;
+  ring.elements[end] = x;
+  if (ring.length < ring.capacity) {
+    ring.length++;
+  } else if (++ring.start == ring.capacity) {
+    ring.start = 0;
+  }
+  ring_store_header(&ring);
+  return FROTH_OK;
+}
+
+/* ---- ring.pop ---- ( ring -- x )
+ * Removes the oldest element. */
+static froth_error_t prim_pop(froth_vm_t *vm) {
+  ring_t ring;
+
+  FROTH_TRY(pop_ring(vm, &ring));
+  if (ring.length == 0)
+    return FROTH_ERROR_BOUNDS;
+  froth_cell_t x = ring.elements[ring.start];
+  ring.elements[ring.start] = 0; /* let the collector drop it */
+  if (++ring.start == ring.capacity)
+    ring.start = 0;
+  ring.length--;
+  ring_store_header(&ring);
+  return froth_stack_push(&vm->ds, x);
+}
+
+/* ---- ring.peek ---- ( ring -- x )
+ * The oldest element, which ring.pop would remove. */
+static froth_error_t prim_peek(froth_vm_t *vm) {
+  ring_t ring;
+
+  FROTH_TRY(pop_ring(vm, &ring));
+  if (ring.length == 0)
+    return FROTH_ERROR_BOUNDS;
+  return froth_stack_push(&vm->ds, ring.elements[ring.start]);
+}
+
+/* ---- ring.len ---- ( ring -- n ) */
+static froth_error_t prim_len(froth_vm_t *vm) {
+  ring_t ring;
+
+  FROTH_TRY(pop_ring(vm, &ring));
+  return froth_push(vm, (froth_cell_t)ring.length);
+}
+
+/* ---- ring.sum ---- ( ring -- n )
+ * Wraps on overflow, as + does. An empty ring sums to 0. */
+static froth_error_t prim_sum(froth_vm_t *vm) {
+  ring_t ring;
+  froth_cell_u_t sum = 0;
+
+  FROTH_TRY(pop_numbers(vm, &ring));
+  for (froth_cell_u_t i = 0, at = ring.start; i < ring.length; i++) {
+    sum += (froth_cell_u_t)FROTH_CELL_STRIP_TAG(ring.elements[at]);
+    if (++at == ring.capacity)
+      at = 0;
+  }
+  return froth_push(vm, froth_wrap_payload(sum));
+}
+
+/* ---- ring.min / ring.max ---- ( ring -- n ) */
+static froth_error_t push_extreme(froth_vm_t *vm, bool want_max) {
+  ring_t ring;
+
+  FROTH_TRY(pop_numbers(vm, &ring));
+  if (ring.length == 0)
+    return FROTH_ERROR_BOUNDS;
+  froth_cell_t best = FROTH_CELL_STRIP_TAG(ring.elements[ring.start]);
+  for (froth_cell_u_t i = 1, at = ring.start; i < ring.length; i++) {
+    if (++at == ring.capacity)
+      at = 0;
+    froth_cell_t x = FROTH_CELL_STRIP_TAG(ring.elements[at]);
+    if (want_max ? x > best : x < best)
+      best = x;
+  }
+  return froth_push(vm, best);
+}
+
+static froth_error_t prim_min(froth_vm_t *vm) {
+  return push_extreme(vm, false);
+}
+
+static froth_error_t prim_max(froth_vm_t *vm) {
+  return push_extreme(vm, true);
+}
+
+/* ---- ring.avg ---- ( ring -- n )
+ * The mean, truncated toward zero as /mod does. Each element is split into a
+ * floored quotient and a remainder by the length, and remainders carry
+ * into the quotient, so nothing overflows however large the elements. */
+static froth_error_t prim_avg(froth_vm_t *vm) {
+  ring_t ring;
+  froth_cell_t mean = 0, remainder = 0;
+
+  FROTH_TRY(pop_numbers(vm, &ring));
+  if (ring.length == 0)
+    return FROTH_ERROR_BOUNDS;
+  froth_cell_t n = (froth_cell_t)ring.length;
+  for (froth_cell_u_t i = 0, at = ring.start; i < ring.length; i++) {
+    froth_cell_t x = FROTH_CELL_STRIP_TAG(ring.elements[at]);
+    froth_cell_t q = x / n, r = x % n;
+    if (r < 0) {
+      q--;
+      r += n;
+    }
+    mean += q;
+    remainder += r;
+    if (remainder >= n) {
+      remainder -= n;
+      mean++;
+    }
+    if (++at == ring.capacity)
+      at = 0;
+  }
+
+  if (mean < 0 && remainder != 0)
+    mean++;
+  return froth_push(vm, mean);
+}
+
+FROTH_FFI(prim_new, "ring.new", "( n -- ring )",
+          "New ring holding the last n values pushed");
+FROTH_FFI(prim_push, "ring.push", "( x ring -- )",
+          "Append x, dropping the oldest value when full");
+FROTH_FFI(prim_pop, "ring.pop", "( ring -- x )", "Remove the oldest value");
+FROTH_FFI(prim_peek, "ring.peek", "( ring -- x )", "The oldest value");
+FROTH_FFI(prim_len, "ring.len", "( ring -- n )", "Number of values held");
+FROTH_FFI(prim_sum, "ring.sum", "( ring -- n )", "Sum of the values");
+FROTH_FFI(prim_min, "ring.min", "( ring -- n )", "Smallest value");
+FROTH_FFI(prim_max, "ring.max", "( ring -- n )", "Largest value");
+FROTH_FFI(prim_avg, "ring.avg", "( ring -- n )",
+          "Mean of the values, truncated");
+
+const froth_ffi_entry_t froth_ring_prims[] = {
+    FROTH_BIND(prim_new),
+    FROTH_BIND(prim_push),
+    FROTH_BIND(prim_pop),
+    FROTH_BIND(prim_peek),
+    FROTH_BIND(prim_len),
+    FROTH_BIND(prim_sum),
+    FROTH_BIND(prim_min),
+    FROTH_BIND(prim_max),
+    FROTH_BIND(prim_avg),
+    {0},
+};
+
+#endif /* FROTH_RINGS */
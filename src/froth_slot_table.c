@@ -1,17 +1,78 @@
 #include "froth_slot_table.h"
+#include "froth_jit.h"
+#include "froth_primitives.h"
 #include <string.h>
 
 froth_slot_t slot_table[FROTH_SLOT_TABLE_SIZE];
 static froth_cell_u_t slot_pointer = 0;
 
+/* Name index: open addressing with linear probing over slot numbers plus
+ * one, 0 marking an empty entry. Twice as many entries as slots keeps it
+ * at most half full, so a probe always reaches an empty entry. Slots are
+ * only ever added, or dropped all together by reset_overlay, which
+ * rebuilds the index; so there are no deletions to handle. */
+#define NAME_INDEX_SIZE (2 * FROTH_SLOT_TABLE_SIZE)
+#if FROTH_SLOT_TABLE_SIZE < 255
+typedef uint8_t name_index_entry_t;
+#else
+typedef uint16_t name_index_entry_t;
+#endif
+static name_index_entry_t name_index[NAME_INDEX_SIZE];
+
+/* FNV-1a over the name's bytes. */
+static froth_cell_u_t name_home(const char *name, size_t len) {
+  uint32_t h = 2166136261u;
+  while (len-- > 0)
+    h = (h ^ (uint8_t)*name++) * 16777619u;
+  return (froth_cell_u_t)(h % NAME_INDEX_SIZE);
+}
+
+static void name_index_add(froth_cell_u_t slot_index) {
+  const char *name = slot_table[slot_index].name;
+  froth_cell_u_t i = name_home(name, strlen(name));
+  while (name_index[i] != 0)
+    i = i + 1 == NAME_INDEX_SIZE ? 0 : i + 1;
+  name_index[i] = (name_index_entry_t)(slot_index + 1);
+}
+
 static char index_has_slot_assigned(froth_cell_u_t index) {
   return slot_table[index].name != NULL;
 }
 
-froth_error_t froth_slot_find_name(const char *name,
+/* Recompute the code field after prim or impl changes. A prim always wins,
+ * matching the lookup order of froth_execute_slot. */
+static void refresh_code(froth_slot_t *slot) {
+  slot->binop = NULL;
+  if (slot->prim != NULL) {
+    slot->code = froth_prim_code(slot->prim);
+    slot->binop = froth_prim_binop(slot->prim);
+    if (slot->binop != NULL)
+      slot->code = FROTH_CODE_BINOP;
+  } else if (slot->impl == 0) {
+    slot->code = FROTH_CODE_UNDEFINED;
+  } else if (FROTH_CELL_IS_QUOTE(slot->impl)) {
+    slot->code = FROTH_CODE_QUOTE;
+  } else {
+    slot->code = FROTH_CODE_VALUE;
+  }
+}
+
+/* A verified effect (ADR-055) and JIT code (ADR-057) depend on every word
+ * the body calls, so any rebinding drops them all. They are recomputed on
+ * the next call. */
+static void forget_derived(void) {
+  for (froth_cell_u_t i = 0; i < slot_pointer; i++)
+    slot_table[i].verify = FROTH_VERIFY_UNKNOWN;
+  froth_jit_forget();
+}
+
+froth_error_t froth_slot_find_span(const char *name, size_t len,
                                    froth_cell_u_t *found_slot_index) {
-  for (froth_cell_u_t ip = 0; ip < slot_pointer; ip++) {
-    if (strcmp(slot_table[ip].name, name) == 0) {
+  for (froth_cell_u_t i = name_home(name, len); name_index[i] != 0;
+       i = i + 1 == NAME_INDEX_SIZE ? 0 : i + 1) {
+    froth_cell_u_t ip = name_index[i] - 1;
+    if (strncmp(slot_table[ip].name, name, len) == 0 &&
+        slot_table[ip].name[len] == '\0') {
       *found_slot_index = ip;
       return FROTH_OK;
     }
@@ -19,29 +80,54 @@ froth_error_t froth_slot_find_name(const char *name,
   return FROTH_ERROR_UNDEFINED_WORD;
 }
 
-froth_error_t froth_slot_create(const char *name, froth_heap_t *heap,
-                                froth_cell_u_t *created_slot_index) {
+froth_error_t froth_slot_find_name(const char *name,
+                                   froth_cell_u_t *found_slot_index) {
+  return froth_slot_find_span(name, strlen(name), found_slot_index);
+}
+
+froth_error_t froth_slot_create_span(const char *name, size_t len,
+                                     froth_heap_t *heap,
+                                     froth_cell_u_t *created_slot_index) {
   if (slot_pointer >= FROTH_SLOT_TABLE_SIZE) {
     return FROTH_ERROR_SLOT_TABLE_FULL;
   }
 
   froth_cell_u_t name_heap_location;
 
-  if (froth_heap_allocate_bytes(strlen(name) + 1, heap, &name_heap_location) ==
+  if (froth_heap_allocate_bytes(len + 1, heap, &name_heap_location) ==
       FROTH_ERROR_HEAP_OUT_OF_MEMORY) {
     return FROTH_ERROR_HEAP_OUT_OF_MEMORY;
   }
 
   char *name_in_heap = (char *)(heap->data + name_heap_location);
-  strcpy(name_in_heap, name);
+  memcpy(name_in_heap, name, len);
+  name_in_heap[len] = '\0';
+
+  return froth_slot_create_named(name_in_heap, created_slot_index);
+}
+
+froth_error_t froth_slot_create_named(const char *name_in_heap,
+                                      froth_cell_u_t *created_slot_index) {
+  if (slot_pointer >= FROTH_SLOT_TABLE_SIZE) {
+    return FROTH_ERROR_SLOT_TABLE_FULL;
+  }
 
   *created_slot_index = slot_pointer;
   slot_table[slot_pointer++] =
-      (froth_slot_t){.name = name_in_heap, .impl = 0, .prim = NULL};
+      (froth_slot_t){.name = name_in_heap,
+                     .impl = 0,
+                     .prim = NULL,
+                     .code = FROTH_CODE_UNDEFINED};
+  name_index_add(*created_slot_index);
 
   return FROTH_OK;
 }
 
+froth_error_t froth_slot_create(const char *name, froth_heap_t *heap,
+                                froth_cell_u_t *created_slot_index) {
+  return froth_slot_create_span(name, strlen(name), heap, created_slot_index);
+}
+
 froth_error_t froth_slot_find_name_or_create(froth_heap_t *froth_heap,
                                              const char *name,
                                              froth_cell_u_t *slot_index) {
@@ -84,6 +170,8 @@ froth_error_t froth_slot_set_impl(froth_cell_u_t slot_index,
     return FROTH_ERROR_UNDEFINED_WORD;
   }
   slot_table[slot_index].impl = impl;
+  refresh_code(&slot_table[slot_index]);
+  forget_derived();
   return FROTH_OK;
 }
 froth_error_t froth_slot_set_prim(froth_cell_u_t slot_index,
@@ -92,9 +180,17 @@ froth_error_t froth_slot_set_prim(froth_cell_u_t slot_index,
     return FROTH_ERROR_UNDEFINED_WORD;
   }
   slot_table[slot_index].prim = prim;
+  refresh_code(&slot_table[slot_index]);
+  forget_derived();
   return FROTH_OK;
 }
 
+void froth_slot_move(froth_cell_u_t slot_index, froth_cell_t impl,
+                     const char *name) {
+  slot_table[slot_index].impl = impl;
+  slot_table[slot_index].name = name;
+}
+
 froth_error_t froth_slot_get_name(froth_cell_u_t slot_index,
                                   const char **name) {
   if (!index_has_slot_assigned(slot_index)) {
@@ -131,8 +227,14 @@ froth_error_t froth_slot_reset_overlay(void) {
       slot_table[i].impl = 0;
       slot_table[i].prim = NULL;
       slot_table[i].overlay = 0;
+      slot_table[i].code = FROTH_CODE_UNDEFINED;
     }
   }
   slot_pointer = new_pointer;
+
+  memset(name_index, 0, sizeof(name_index));
+  for (froth_cell_u_t i = 0; i < slot_pointer; i++)
+    name_index_add(i);
+  forget_derived();
   return FROTH_OK;
 }
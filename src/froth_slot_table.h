@@ -3,19 +3,57 @@
 #include "froth_heap.h"
 #include "froth_types.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifndef FROTH_SLOT_TABLE_SIZE
 #error                                                                         \
     "FROTH_SLOT_TABLE_SIZE is not defined. Please define it to the desired size of the slot table."
 #endif
 
+/* Code field: what executing the slot does. Derived from prim/impl by the
+ * setters below so the executor can dispatch on one byte instead of probing
+ * prim and impl separately. */
+typedef enum {
+  FROTH_CODE_UNDEFINED = 0,
+  FROTH_CODE_PRIM = 1,
+  FROTH_CODE_QUOTE = 2,
+  FROTH_CODE_VALUE = 3,
+  /* Control primitives the executor runs as CS frames (ADR-053). */
+  FROTH_CODE_WHILE = 4,
+  FROTH_CODE_CATCH = 5,
+  FROTH_CODE_CALL = 6,
+  /* Binary number prim with a froth_binop_t fast path (ADR-054). */
+  FROTH_CODE_BINOP = 7,
+} froth_code_kind_t;
+
+/* Stack-effect verification state of a quotation word (ADR-055). */
+typedef enum {
+  FROTH_VERIFY_UNKNOWN = 0,
+  FROTH_VERIFY_REJECTED = 1,
+  FROTH_VERIFY_OK = 2,
+} froth_verify_state_t;
+
 typedef struct {
   const char *name;
   froth_cell_t impl; // Pointer into heap (for quoteRef)
   froth_native_word_t prim;
+  froth_binop_t binop; // Fast path of prim, or NULL (ADR-054)
   uint8_t overlay;
+  uint8_t code; // froth_code_kind_t, kept in sync by set_impl/set_prim
+  uint8_t verify;  // froth_verify_state_t, reset by set_impl/set_prim
+  uint8_t ds_in;   // If verified: cells consumed below the entry depth
+  uint8_t ds_out;  // If verified: cells left in their place
+  uint8_t ds_peak; // If verified: highest depth above the entry depth
 } froth_slot_t;
 
+extern froth_slot_t slot_table[FROTH_SLOT_TABLE_SIZE];
+
+/* Unchecked slot access for the executor's hot path. The caller guarantees
+ * slot_index came from a FROTH_CALL cell, so it is in range. */
+static inline const froth_slot_t *froth_slot_entry(froth_cell_u_t slot_index) {
+  return &slot_table[slot_index];
+}
+
 // find_name should return an erorr if not found, otherwise write to the result
 // pointer.
 froth_error_t froth_slot_find_name_or_create(froth_heap_t *froth_heap,
@@ -25,6 +63,17 @@ froth_error_t froth_slot_find_name(const char *name,
                                    froth_cell_u_t *found_slot_index);
 froth_error_t froth_slot_create(const char *name, froth_heap_t *froth_heap,
                                 froth_cell_u_t *created_slot_index);
+/* The same for a name given as len bytes that need not be NUL-terminated,
+ * such as a token in the reader's input. */
+froth_error_t froth_slot_find_span(const char *name, size_t len,
+                                   froth_cell_u_t *found_slot_index);
+froth_error_t froth_slot_create_span(const char *name, size_t len,
+                                     froth_heap_t *froth_heap,
+                                     froth_cell_u_t *created_slot_index);
+/* Append a slot whose name is already on the heap, as in a boot image
+ * (ADR-071). */
+froth_error_t froth_slot_create_named(const char *name_in_heap,
+                                      froth_cell_u_t *created_slot_index);
 froth_error_t froth_slot_get_impl(froth_cell_u_t slot_index,
                                   froth_cell_t *impl);
 froth_error_t froth_slot_get_prim(froth_cell_u_t slot_index,
@@ -35,6 +84,10 @@ froth_error_t froth_slot_set_prim(froth_cell_u_t slot_index,
 froth_error_t froth_slot_get_name(froth_cell_u_t slot_index, const char **name);
 froth_error_t froth_slot_set_overlay(froth_cell_u_t slot_index,
                                      uint8_t overlay);
+/* The collector (ADR-059) moved this slot's impl and name. Unlike set_impl,
+ * the code field and verification are kept. */
+void froth_slot_move(froth_cell_u_t slot_index, froth_cell_t impl,
+                     const char *name);
 froth_cell_u_t froth_slot_count(void);
 bool froth_slot_is_overlay(froth_cell_u_t slot_index);
 froth_error_t froth_slot_reset_overlay(void);
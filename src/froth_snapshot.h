@@ -2,7 +2,7 @@
 #include "froth_types.h"
 
 #define FROTH_SNAPSHOT_MAGIC "FRTHSNAP"
-#define FROTH_SNAPSHOT_VERSION 0x0004
+#define FROTH_SNAPSHOT_VERSION 0x0005
 #define FROTH_SNAPSHOT_MAX_BYTES 1024
 #define FROTH_SNAPSHOT_MAX_OBJECTS 50
 #define FROTH_SNAPSHOT_MAX_QUOTE_DEPTH 10
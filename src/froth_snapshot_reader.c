@@ -1,4 +1,9 @@
+#include "froth_body.h"
+#include "froth_fuse.h"
 #include "froth_heap.h"
+#include "froth_intern.h"
+#include "froth_mem.h"
+#include "froth_object.h"
 #include "froth_slot_table.h"
 #include "froth_snapshot.h"
 #include "froth_types.h"
@@ -92,6 +97,8 @@ froth_error_t read_bytes(snapshot_reader_t *reader, froth_cell_u_t num_bytes,
 
 froth_error_t reset_overlay_to_base(froth_vm_t *froth_vm) {
   froth_vm->heap.pointer = froth_vm->watermark_heap_offset;
+  froth_intern_forget_from(froth_vm->watermark_heap_offset);
+  froth_mem_note_restore(0);
   FROTH_TRY(froth_slot_reset_overlay());
   return FROTH_OK;
 }
@@ -125,34 +132,52 @@ froth_error_t read_names(froth_vm_t *froth_vm, snapshot_reader_t *reader,
 
 // --- Object loading: read directly from snapshot stream into heap ---
 
+/* Tokens are in the quotation byte code (ADR-062), with object and name
+ * ids as payloads. */
+static froth_error_t read_token(snapshot_reader_t *reader,
+                                froth_cell_t *token) {
+  uint8_t bytes[FROTH_BODY_TOKEN_MAX];
+  froth_cell_u_t position = 0;
+
+  FROTH_TRY(read_u8(reader, &bytes[0]));
+  froth_cell_u_t width = froth_body_payload_width(bytes[0]);
+  if (width > sizeof(froth_cell_t)) {
+    return FROTH_ERROR_SNAPSHOT_FORMAT;
+  }
+  FROTH_TRY(read_bytes(reader, width, &bytes[1]));
+
+  *token = froth_body_decode(bytes, &position);
+  return FROTH_OK;
+}
+
 static froth_error_t load_quote_token(snapshot_reader_t *reader,
                                       froth_cell_u_t *names,
                                       froth_cell_t *objects,
                                       froth_cell_t *out_cell) {
-  uint8_t tag;
-  FROTH_TRY(read_u8(reader, &tag));
+  froth_cell_t token;
 
-  switch (tag) {
-  case FROTH_NUMBER: {
-    froth_cell_t value;
-    FROTH_TRY(read_cell(reader, &value));
-    return froth_make_cell(value, FROTH_NUMBER, out_cell);
-  }
+  FROTH_TRY(read_token(reader, &token));
+  froth_cell_t id = FROTH_CELL_STRIP_TAG(token);
+
+  switch (FROTH_CELL_GET_TAG(token)) {
+  case FROTH_NUMBER:
+    *out_cell = token;
+    return FROTH_OK;
   case FROTH_QUOTE:
   case FROTH_PATTERN:
   case FROTH_BSTRING:
-  case FROTH_CONTRACT: {
-    uint32_t obj_id;
-    FROTH_TRY(read_u32(reader, &obj_id));
-    *out_cell = objects[obj_id]; // already tagged from earlier load
+  case FROTH_CONTRACT:
+    if (id < 0 || id >= FROTH_SNAPSHOT_MAX_OBJECTS) {
+      return FROTH_ERROR_SNAPSHOT_FORMAT;
+    }
+    *out_cell = objects[id]; // already tagged from earlier load
     return FROTH_OK;
-  }
   case FROTH_CALL:
-  case FROTH_SLOT: {
-    uint16_t name_id;
-    FROTH_TRY(read_u16(reader, &name_id));
-    return froth_make_cell(names[name_id], tag, out_cell);
-  }
+  case FROTH_SLOT:
+    if (id < 0 || id >= FROTH_SLOT_TABLE_SIZE) {
+      return FROTH_ERROR_SNAPSHOT_FORMAT;
+    }
+    return froth_make_cell(names[id], FROTH_CELL_GET_TAG(token), out_cell);
   default:
     return FROTH_ERROR_SNAPSHOT_FORMAT;
   }
@@ -164,19 +189,30 @@ static froth_error_t load_quote_object(froth_vm_t *froth_vm,
                                        froth_cell_t *objects,
                                        froth_cell_t *out_cell) {
   uint16_t tok_count;
-  froth_cell_t *cells;
+  froth_cell_t token;
   froth_cell_u_t heap_location;
+  froth_cell_u_t length = 0;
+  froth_cell_u_t ip = 1;
 
   FROTH_TRY(read_u16(reader, &tok_count));
-  FROTH_TRY(froth_heap_allocate_cells(tok_count + 1, &froth_vm->heap,
-                                      &cells, &heap_location));
 
-  cells[0] = tok_count;
+  /* Size the body first: a compact one depends on its tokens. */
+  snapshot_reader_t tokens = *reader;
+  for (uint16_t i = 0; i < tok_count; i++) {
+    FROTH_TRY(load_quote_token(reader, names, objects, &token));
+    length += froth_body_token_length(token);
+  }
+  *reader = tokens;
+
+  FROTH_TRY(froth_body_allocate(&froth_vm->heap, length, &heap_location));
   for (uint16_t i = 0; i < tok_count; i++) {
-    FROTH_TRY(load_quote_token(reader, names, objects, &cells[i + 1]));
+    FROTH_TRY(load_quote_token(reader, names, objects, &token));
+    froth_body_put(&froth_vm->heap, heap_location, &ip, token);
   }
 
-  return froth_make_cell(heap_location, FROTH_QUOTE, out_cell);
+  FROTH_TRY(froth_make_cell(heap_location, FROTH_QUOTE, out_cell));
+  froth_fuse_quote(froth_vm, *out_cell); // snapshots store unfused bodies
+  return FROTH_OK;
 }
 
 static froth_error_t load_pattern_object(froth_vm_t *froth_vm,
@@ -214,6 +250,82 @@ static froth_error_t load_bstring_object(froth_vm_t *froth_vm,
   return froth_make_cell(heap_location, FROTH_BSTRING, out_cell);
 }
 
+/* Body cells keep object references as ids until every object is loaded:
+ * objects may refer forward, or to themselves. resolve_object_refs swaps
+ * them for cells. */
+static froth_error_t load_mutable_object(froth_vm_t *froth_vm,
+                                         snapshot_reader_t *reader,
+                                         froth_cell_u_t *names,
+                                         froth_cell_t *out_cell) {
+  uint8_t kind;
+  uint16_t count;
+  froth_cell_u_t heap_location;
+
+  FROTH_TRY(read_u8(reader, &kind));
+  FROTH_TRY(read_u16(reader, &count));
+  if (kind > FROTH_OBJECT_RING) {
+    return FROTH_ERROR_SNAPSHOT_FORMAT;
+  }
+  FROTH_TRY(froth_object_allocate(&froth_vm->heap, (froth_object_kind_t)kind,
+                                  count, &heap_location));
+
+  for (uint16_t i = 0; i < count; i++) {
+    froth_cell_t token;
+    FROTH_TRY(read_token(reader, &token));
+    if (FROTH_CELL_IS_CALL(token) || FROTH_CELL_IS_SLOT(token)) {
+      froth_cell_t id = FROTH_CELL_STRIP_TAG(token);
+      if (id < 0 || id >= FROTH_SLOT_TABLE_SIZE) {
+        return FROTH_ERROR_SNAPSHOT_FORMAT;
+      }
+      FROTH_TRY(froth_make_cell(names[id], FROTH_CELL_GET_TAG(token), &token));
+    } else if (FROTH_CELL_IS_EXT(token) && !FROTH_CELL_IS_OBJECT(token)) {
+      return FROTH_ERROR_SNAPSHOT_FORMAT;
+    }
+    froth_object_cells(&froth_vm->heap, heap_location)[i] = token;
+  }
+
+  *out_cell = froth_object_cell(heap_location);
+  return FROTH_OK;
+}
+
+static froth_error_t resolve_object_refs(froth_vm_t *froth_vm,
+                                         froth_cell_t *objects,
+                                         uint32_t obj_count) {
+  for (uint32_t i = 0; i < obj_count; i++) {
+    if (!FROTH_CELL_IS_OBJECT(objects[i])) {
+      continue;
+    }
+
+    froth_cell_u_t offset = froth_object_offset(objects[i]);
+    froth_cell_t *cells = froth_object_cells(&froth_vm->heap, offset);
+    for (froth_cell_u_t j = 0; j < froth_object_count(&froth_vm->heap, offset);
+         j++) {
+      froth_cell_t cell = cells[j];
+      froth_cell_u_t id;
+
+      switch (FROTH_CELL_GET_TAG(cell)) {
+      case FROTH_QUOTE:
+      case FROTH_PATTERN:
+      case FROTH_BSTRING:
+      case FROTH_CONTRACT:
+        id = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell);
+        break;
+      case FROTH_EXT:
+        id = froth_object_offset(cell);
+        break;
+      default:
+        continue;
+      }
+      if (id >= obj_count) {
+        return FROTH_ERROR_SNAPSHOT_FORMAT;
+      }
+      cells[j] = objects[id];
+    }
+  }
+
+  return FROTH_OK;
+}
+
 static froth_error_t load_object(froth_vm_t *froth_vm,
                                  snapshot_reader_t *reader,
                                  froth_cell_u_t *names,
@@ -236,6 +348,8 @@ static froth_error_t load_object(froth_vm_t *froth_vm,
     return load_pattern_object(froth_vm, reader, out_cell);
   case FROTH_BSTRING:
     return load_bstring_object(froth_vm, reader, out_cell);
+  case FROTH_EXT:
+    return load_mutable_object(froth_vm, reader, names, out_cell);
   default:
     return FROTH_ERROR_SNAPSHOT_FORMAT;
   }
@@ -248,11 +362,15 @@ static froth_error_t load_objects(froth_vm_t *froth_vm,
   uint32_t obj_count;
   FROTH_TRY(read_u32(reader, &obj_count));
 
+  if (obj_count > FROTH_SNAPSHOT_MAX_OBJECTS) {
+    return FROTH_ERROR_SNAPSHOT_FORMAT;
+  }
+
   for (uint32_t i = 0; i < obj_count; i++) {
     FROTH_TRY(load_object(froth_vm, reader, names, objects, &objects[i]));
   }
 
-  return FROTH_OK;
+  return resolve_object_refs(froth_vm, objects, obj_count);
 }
 
 // --- Slot bindings: resolve impl values and apply to slot table ---
@@ -273,7 +391,8 @@ static froth_error_t decode_binding_impl(snapshot_reader_t *reader,
   case FROTH_QUOTE:
   case FROTH_PATTERN:
   case FROTH_BSTRING:
-  case FROTH_CONTRACT: {
+  case FROTH_CONTRACT:
+  case FROTH_EXT: {
     uint32_t obj_id;
     FROTH_TRY(read_u32(reader, &obj_id));
     *out_cell = objects[obj_id];
@@ -336,5 +455,7 @@ froth_error_t froth_snapshot_load(froth_vm_t *froth_vm,
   FROTH_TRY(load_objects(froth_vm, &reader, ws->reader_names, ws->reader_objects));
   FROTH_TRY(load_bindings(&reader, ws->reader_names, ws->reader_objects));
 
+  froth_mem_note_restore(froth_vm->heap.pointer -
+                         froth_vm->watermark_heap_offset);
   return FROTH_OK;
 }
@@ -1,4 +1,7 @@
+#include "froth_body.h"
+#include "froth_fuse.h"
 #include "froth_heap.h"
+#include "froth_object.h"
 #include "froth_slot_table.h"
 #include "froth_snapshot.h"
 #include "froth_tbuf.h"
@@ -152,6 +155,11 @@ static froth_error_t collect_cell_dependencies(froth_cell_t cell,
     return name_table_add_slot(name_table, FROTH_CELL_STRIP_TAG(cell));
   }
 
+  if (FROTH_CELL_IS_OBJECT(cell)) {
+    return object_table_add_if_missing(object_table, froth_object_offset(cell),
+                                       FROTH_EXT);
+  }
+
   return FROTH_OK;
 }
 
@@ -167,7 +175,6 @@ static froth_error_t collect_quote_dependencies(froth_vm_t *froth_vm,
 
   while (walk_stack.depth > 0) {
     quote_walk_frame_t frame;
-    froth_cell_t *quote_cells;
     froth_cell_u_t quote_length;
     bool descended_into_child = false;
 
@@ -177,23 +184,24 @@ static froth_error_t collect_quote_dependencies(froth_vm_t *froth_vm,
       continue;
     }
 
-    quote_cells = froth_heap_cell_ptr(&froth_vm->heap, frame.quote_heap_offset);
-    quote_length = (froth_cell_u_t)quote_cells[0];
+    quote_length =
+        froth_body_length(&froth_vm->heap, frame.quote_heap_offset);
 
-    for (froth_cell_u_t token_index = frame.next_token_index;
-         token_index <= quote_length; token_index++) {
-      froth_cell_t token = quote_cells[token_index];
+    for (froth_cell_u_t ip = frame.next_token_index; ip <= quote_length;) {
+      froth_cell_t token =
+          froth_body_next(&froth_vm->heap, frame.quote_heap_offset, &ip);
 
       if (FROTH_CELL_IS_QUOTE(token)) {
-        FROTH_TRY(quote_walk_stack_push(&walk_stack, frame.quote_heap_offset,
-                                        token_index + 1));
+        FROTH_TRY(
+            quote_walk_stack_push(&walk_stack, frame.quote_heap_offset, ip));
         FROTH_TRY(
             quote_walk_stack_push(&walk_stack, FROTH_CELL_STRIP_TAG(token), 1));
         descended_into_child = true;
         break;
       }
 
-      FROTH_TRY(collect_cell_dependencies(token, name_table, object_table));
+      FROTH_TRY(collect_cell_dependencies(froth_fuse_original(token),
+                                          name_table, object_table));
     }
 
     if (!descended_into_child) {
@@ -205,6 +213,34 @@ static froth_error_t collect_quote_dependencies(froth_vm_t *froth_vm,
   return FROTH_OK;
 }
 
+/* Objects may refer to each other in any order, cycles included: the
+ * reader resolves their references after loading every object (ADR-064).
+ * Walking the table by index reaches objects added along the way. */
+static froth_error_t collect_object_dependencies(froth_vm_t *froth_vm,
+                                                 name_table_t *name_table,
+                                                 object_table_t *object_table) {
+  for (froth_cell_u_t i = 0; i < object_table->count; i++) {
+    if (object_table->items[i].type != FROTH_EXT)
+      continue;
+
+    froth_cell_u_t offset = object_table->items[i].heap_offset;
+    if (!froth_object_in_heap(&froth_vm->heap, offset))
+      return FROTH_ERROR_SNAPSHOT_FORMAT;
+    froth_cell_u_t count = froth_object_count(&froth_vm->heap, offset);
+    for (froth_cell_u_t j = 0; j < count; j++) {
+      froth_cell_t cell = froth_object_cells(&froth_vm->heap, offset)[j];
+      if (FROTH_CELL_IS_QUOTE(cell)) {
+        FROTH_TRY(collect_quote_dependencies(froth_vm, cell, name_table,
+                                             object_table));
+        continue;
+      }
+      FROTH_TRY(collect_cell_dependencies(cell, name_table, object_table));
+    }
+  }
+
+  return FROTH_OK;
+}
+
 static froth_error_t
 collect_snapshot_dependencies(froth_vm_t *froth_vm, name_table_t *name_table,
                               object_table_t *object_table) {
@@ -233,14 +269,13 @@ collect_snapshot_dependencies(froth_vm_t *froth_vm, name_table_t *name_table,
       continue;
     }
 
-    if (FROTH_CELL_IS_PATTERN(slot_impl) || FROTH_CELL_IS_BSTRING(slot_impl)) {
-      FROTH_TRY(object_table_add_if_missing(object_table,
-                                            FROTH_CELL_STRIP_TAG(slot_impl),
-                                            FROTH_CELL_GET_TAG(slot_impl)));
+    if (FROTH_CELL_IS_PATTERN(slot_impl) || FROTH_CELL_IS_BSTRING(slot_impl) ||
+        FROTH_CELL_IS_OBJECT(slot_impl)) {
+      FROTH_TRY(collect_cell_dependencies(slot_impl, name_table, object_table));
     }
   }
 
-  return FROTH_OK;
+  return collect_object_dependencies(froth_vm, name_table, object_table);
 }
 
 static froth_error_t emit_u8(froth_snapshot_buffer_t *snapshot, uint8_t value) {
@@ -389,36 +424,80 @@ static froth_error_t emit_bstring_object(froth_snapshot_buffer_t *snapshot,
   return FROTH_OK;
 }
 
+/* Tokens use the quotation byte code (ADR-062), with the object or name id
+ * in place of a heap offset or slot index. */
 static froth_error_t emit_quote_token(froth_snapshot_buffer_t *snapshot,
                                       froth_cell_t token,
                                       const name_table_t *name_table,
                                       const object_table_t *object_table) {
-  froth_cell_u_t object_id;
-  froth_cell_u_t name_id;
-
-  FROTH_TRY(emit_u8(snapshot, (uint8_t)FROTH_CELL_GET_TAG(token)));
+  froth_cell_u_t id;
+  uint8_t bytes[FROTH_BODY_TOKEN_MAX];
 
   switch (FROTH_CELL_GET_TAG(token)) {
   case FROTH_NUMBER:
-    return emit_cell(snapshot, FROTH_CELL_STRIP_TAG(token));
+    break;
 
   case FROTH_QUOTE:
   case FROTH_BSTRING:
   case FROTH_CONTRACT:
   case FROTH_PATTERN:
-    FROTH_TRY(object_table_find_id(object_table, FROTH_CELL_STRIP_TAG(token),
-                                   &object_id));
-    return emit_u32(snapshot, (uint32_t)object_id);
+    FROTH_TRY(
+        object_table_find_id(object_table, FROTH_CELL_STRIP_TAG(token), &id));
+    token = FROTH_CELL_PACK_TAG((froth_cell_t)id, FROTH_CELL_GET_TAG(token));
+    break;
 
   case FROTH_CALL:
   case FROTH_SLOT:
+    FROTH_TRY(name_table_find_id(name_table, FROTH_CELL_STRIP_TAG(token), &id));
+    token = FROTH_CELL_PACK_TAG((froth_cell_t)id, FROTH_CELL_GET_TAG(token));
+    break;
+
+  case FROTH_EXT:
+    if (!FROTH_CELL_IS_OBJECT(token))
+      return FROTH_ERROR_SNAPSHOT_FORMAT;
     FROTH_TRY(
-        name_table_find_id(name_table, FROTH_CELL_STRIP_TAG(token), &name_id));
-    return emit_u16(snapshot, (uint16_t)name_id);
+        object_table_find_id(object_table, froth_object_offset(token), &id));
+    token = froth_object_cell(id);
+    break;
 
   default:
     return FROTH_ERROR_SNAPSHOT_FORMAT;
   }
+
+  return emit_bytes(snapshot, bytes, froth_body_encode(token, bytes));
+}
+
+/* Kind, cell count, then each body cell as a token. */
+static froth_error_t emit_mutable_object(froth_snapshot_buffer_t *snapshot,
+                                         froth_vm_t *froth_vm,
+                                         froth_cell_u_t heap_offset,
+                                         const name_table_t *name_table,
+                                         const object_table_t *object_table) {
+  froth_cell_u_t count = froth_object_count(&froth_vm->heap, heap_offset);
+  froth_cell_u_t object_length_position = snapshot->position;
+  froth_cell_u_t payload_start;
+
+  if (!froth_object_in_heap(&froth_vm->heap, heap_offset) ||
+      count > UINT16_MAX) {
+    return FROTH_ERROR_SNAPSHOT_FORMAT;
+  }
+
+  FROTH_TRY(emit_u32(snapshot, 0));
+  payload_start = snapshot->position;
+
+  FROTH_TRY(
+      emit_u8(snapshot, (uint8_t)froth_object_kind(&froth_vm->heap, heap_offset)));
+  FROTH_TRY(emit_u16(snapshot, (uint16_t)count));
+  for (froth_cell_u_t i = 0; i < count; i++) {
+    FROTH_TRY(emit_quote_token(snapshot,
+                               froth_object_cells(&froth_vm->heap, heap_offset)[i],
+                               name_table, object_table));
+  }
+
+  patch_u32(snapshot, object_length_position,
+            (uint32_t)(snapshot->position - payload_start));
+
+  return FROTH_OK;
 }
 
 static froth_error_t emit_quote_object(froth_snapshot_buffer_t *snapshot,
@@ -426,19 +505,20 @@ static froth_error_t emit_quote_object(froth_snapshot_buffer_t *snapshot,
                                        froth_cell_u_t heap_offset,
                                        const name_table_t *name_table,
                                        const object_table_t *object_table) {
-  froth_cell_t *quote_cells = froth_heap_cell_ptr(&froth_vm->heap, heap_offset);
-  froth_cell_u_t quote_length = (froth_cell_u_t)quote_cells[0];
+  froth_cell_u_t quote_length = froth_body_length(&froth_vm->heap, heap_offset);
   froth_cell_u_t object_length_position = snapshot->position;
   froth_cell_u_t payload_start;
 
   FROTH_TRY(emit_u32(snapshot, 0));
   payload_start = snapshot->position;
 
-  FROTH_TRY(emit_u16(snapshot, (uint16_t)quote_length));
+  FROTH_TRY(emit_u16(snapshot,
+                     (uint16_t)froth_body_count(&froth_vm->heap, heap_offset)));
 
-  for (froth_cell_u_t i = 1; i <= quote_length; i++) {
-    FROTH_TRY(
-        emit_quote_token(snapshot, quote_cells[i], name_table, object_table));
+  for (froth_cell_u_t ip = 1; ip <= quote_length;) {
+    froth_cell_t token = froth_body_next(&froth_vm->heap, heap_offset, &ip);
+    FROTH_TRY(emit_quote_token(snapshot, froth_fuse_original(token),
+                               name_table, object_table));
   }
 
   patch_u32(snapshot, object_length_position,
@@ -473,6 +553,11 @@ static froth_error_t emit_objects(froth_vm_t *froth_vm,
                                   name_table, object_table));
       break;
 
+    case FROTH_EXT:
+      FROTH_TRY(emit_mutable_object(snapshot, froth_vm, object->heap_offset,
+                                    name_table, object_table));
+      break;
+
     default:
       break;
     }
@@ -523,6 +608,15 @@ static froth_error_t emit_binding_impl(froth_snapshot_buffer_t *snapshot,
     return emit_u16(snapshot, (uint16_t)name_id);
   }
 
+  case FROTH_EXT: {
+    froth_cell_u_t object_id;
+    if (!FROTH_CELL_IS_OBJECT(slot_impl))
+      return FROTH_ERROR_SNAPSHOT_FORMAT;
+    FROTH_TRY(object_table_find_id(object_table, froth_object_offset(slot_impl),
+                                   &object_id));
+    return emit_u32(snapshot, (uint32_t)object_id);
+  }
+
   default:
     return FROTH_ERROR_SNAPSHOT_FORMAT;
   }
@@ -22,10 +22,28 @@ typedef struct froth_stack_t {
   froth_cell_t *data;      // An array that holds our cells
 } froth_stack_t;
 
-/* CS frame: continuation state for the trampoline executor. */
+/* CS frame kinds (ADR-053). QUOTE and UNCHECKED frames run a quotation
+ * body. The others are control frames for while and catch: each sits under
+ * the body it started and is resumed when that body returns. */
+typedef enum {
+  FROTH_CS_QUOTE = 0,
+  FROTH_CS_UNCHECKED = 1,  /* verified word, bounds checked on entry (ADR-055) */
+  FROTH_CS_WHILE_COND = 2, /* run the condition next */
+  FROTH_CS_WHILE_TEST = 3, /* condition returned, test its flag */
+  FROTH_CS_CATCH = 4,      /* body returned, or an error unwound to here */
+} froth_cs_kind_t;
+
+/* CS frame: continuation state for the trampoline executor.
+ * Control frames reuse the first two fields:
+ *   WHILE_COND/WHILE_TEST: quote_offset = condition, ip = body offset
+ *   CATCH:                 ip = RS depth at entry */
 typedef struct froth_cs_frame_t {
   froth_cell_u_t quote_offset; /* heap byte offset of the quotation */
   froth_cell_u_t ip;           /* next cell index to execute (1-based) */
+  froth_cell_u_t ds_depth;     /* WHILE/CATCH: DS depth at entry;
+                                  QUOTE/UNCHECKED: JIT body id + 1, or 0
+                                  (ADR-057) */
+  uint8_t kind;                /* froth_cs_kind_t */
 } froth_cs_frame_t;
 
 typedef struct froth_cs_t {
@@ -1,5 +1,6 @@
 #include "froth_tbuf.h"
 #include "froth_heap.h"
+#include "froth_mem.h"
 #include "froth_vm.h"
 #include <string.h>
 
@@ -42,8 +43,8 @@ static bool is_stale(froth_tdesc_t *desc, froth_cell_u_t cell_gen) {
          (desc->generation & FROTH_BSTRING_GEN_MASK) != cell_gen;
 }
 
-froth_error_t froth_tbuf_alloc(froth_vm_t *vm, const uint8_t *data,
-                               froth_cell_t len, froth_cell_t *out_cell) {
+froth_error_t froth_tbuf_reserve(froth_vm_t *vm, froth_cell_t len,
+                                 froth_cell_t *out_cell, uint8_t **bytes) {
   if (len < 0 || len > FROTH_TBUF_SIZE - TBUF_OVERHEAD)
     return FROTH_ERROR_TRANSIENT_FULL;
 
@@ -67,7 +68,7 @@ froth_error_t froth_tbuf_alloc(froth_vm_t *vm, const uint8_t *data,
   tbuf->ring[tbuf->write_cursor++] = (uint8_t)((len >> 8) & 0xFF);
 
   uint16_t payload_offset = tbuf->write_cursor;
-  memcpy(&tbuf->ring[tbuf->write_cursor], data, len);
+  *bytes = &tbuf->ring[tbuf->write_cursor];
   tbuf->write_cursor += len;
   tbuf->ring[tbuf->write_cursor++] = '\0';
 
@@ -80,10 +81,19 @@ froth_error_t froth_tbuf_alloc(froth_vm_t *vm, const uint8_t *data,
   froth_cell_u_t payload =
       FROTH_BSTRING_TRANSIENT_PAYLOAD((froth_cell_u_t)idx, tbuf->generation);
   tbuf->generation++;
+  froth_mem_note_tbuf(tbuf);
 
   return froth_make_cell(payload, FROTH_BSTRING, out_cell);
 }
 
+froth_error_t froth_tbuf_alloc(froth_vm_t *vm, const uint8_t *data,
+                               froth_cell_t len, froth_cell_t *out_cell) {
+  uint8_t *bytes;
+  FROTH_TRY(froth_tbuf_reserve(vm, len, out_cell, &bytes));
+  memcpy(bytes, data, len);
+  return FROTH_OK;
+}
+
 froth_error_t froth_bstring_resolve(froth_vm_t *vm, froth_cell_t cell,
                                     froth_bstring_view_t *view) {
   if (!FROTH_CELL_IS_BSTRING(cell))
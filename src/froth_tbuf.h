@@ -117,6 +117,12 @@ void froth_tbuf_init(struct froth_vm_t *vm);
 froth_error_t froth_tbuf_alloc(struct froth_vm_t *vm, const uint8_t *data,
                                froth_cell_t len, froth_cell_t *out_cell);
 
+/* Allocate a transient string of `len` bytes and leave filling them to the
+ * caller, through `bytes`, before anything else allocates. The evaluator
+ * uses this to decode a string literal straight into the ring. */
+froth_error_t froth_tbuf_reserve(struct froth_vm_t *vm, froth_cell_t len,
+                                 froth_cell_t *out_cell, uint8_t **bytes);
+
 /* Resolve any BSTRING cell (permanent or transient) into a data/len view.
  * For permanent strings, resolves via heap offset (fast path).
  * For transient strings, resolves via descriptor with generation check.
@@ -34,8 +34,19 @@
 #define FROTH_LINK_INPUT_DATA 0x0F
 #define FROTH_LINK_INPUT_WAIT 0x10
 #define FROTH_LINK_OUTPUT_DATA 0x11
+#define FROTH_LINK_PROF_REQ 0x12 /* FROTH_PROFILE builds only (ADR-058) */
+#define FROTH_LINK_PROF_RES 0x13
+#define FROTH_LINK_MEM_REQ 0x14 /* FROTH_MEM_STATS builds only (ADR-063) */
+#define FROTH_LINK_MEM_RES 0x15
 #define FROTH_LINK_ERROR 0xFF
 
+/* EVAL_REQ flags. Bit 0 (want_stack) is reserved; the device always sends
+ * the stack. */
+#define FROTH_LINK_EVAL_MORE 0x02 /* source goes on in the next EVAL_REQ (ADR-072) */
+
+/* HELLO_RES capability IDs (ADR-033) */
+#define FROTH_LINK_CAP_EVAL_STREAM 0x07 /* accepts FROTH_LINK_EVAL_MORE */
+
 typedef struct {
   uint8_t magic[2];
   uint8_t version;
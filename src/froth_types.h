@@ -83,6 +83,8 @@ typedef enum {
   FROTH_ERROR_FFI_TABLE_FULL = 21,        /* too many FFI tables registered */
   FROTH_ERROR_TRANSIENT_EXPIRED = 22,     /* transient string overwritten */
   FROTH_ERROR_TRANSIENT_FULL = 23,        /* transient descriptor table full */
+  FROTH_ERROR_ARENA_DEPTH = 24,           /* FROTH_ARENA_DEPTH arenas open */
+  FROTH_ERROR_KEY_NOT_FOUND = 25,         /* map@ of a key the map lacks */
   /* Reader/evaluator errors — occur before execution.
    * Stable numbers, but programs won't typically catch these. */
   FROTH_ERROR_TOKEN_TOO_LONG = 100,
@@ -93,6 +95,8 @@ typedef enum {
   FROTH_ERROR_UNTERMINATED_STRING = 105,
   FROTH_ERROR_INVALID_ESCAPE = 106,
   FROTH_ERROR_UNEXPECTED_BRACKET = 107,
+  FROTH_ERROR_QUOTE_TOO_LARGE = 108,      /* body cells exceed the free DS */
+  FROTH_ERROR_QUOTE_TOO_DEEP = 109,       /* FROTH_EVAL_NEST_MAX bodies open */
 
   /* Snapshot errors — persistence subsystem (200–299). */
   FROTH_ERROR_SNAPSHOT_OVERFLOW = 200, /* buffer read/write past end */
@@ -138,6 +142,7 @@ typedef enum {
   FROTH_CONTRACT = 5,
   FROTH_CALL =
       6, // internal: invoke SlotRef (only inside quotation bodies, see ADR-009)
+  FROTH_EXT = 7, // extended: payload bit 0 selects the subtype (ADR-050)
 } froth_cell_tag_t;
 
 /* TAGGED CELL ENCODING
@@ -154,9 +159,11 @@ typedef enum {
  *   4 = StringRef    (user-visible value)
  *   5 = ContractRef  (user-visible value)
  *   6 = Call          (internal — invoke SlotRef, only inside quotation bodies)
- *   7 = (reserved)
+ *   7 = Extended     (payload bit 0 = 0: fused superinstruction, internal,
+ *                     only inside quotation bodies; bit 0 = 1: mutable heap
+ *                     object, user-visible value)
  *
- * See ADR-004, ADR-005, ADR-009.
+ * See ADR-004, ADR-005, ADR-009, ADR-050, ADR-064.
  */
 
 #define FROTH_CELL_GET_TAG(val) ((val) & 0x7)
@@ -172,6 +179,11 @@ typedef enum {
 #define FROTH_CELL_IS_CONTRACT(val)                                            \
   ((FROTH_CELL_GET_TAG((val)) == FROTH_CONTRACT))
 #define FROTH_CELL_IS_CALL(val) ((FROTH_CELL_GET_TAG((val)) == FROTH_CALL))
+#define FROTH_CELL_IS_EXT(val) ((FROTH_CELL_GET_TAG((val)) == FROTH_EXT))
+#define FROTH_CELL_IS_FUSED(val)                                               \
+  (FROTH_CELL_IS_EXT((val)) && (FROTH_CELL_STRIP_TAG((val)) & 1) == 0)
+#define FROTH_CELL_IS_OBJECT(val)                                              \
+  (FROTH_CELL_IS_EXT((val)) && (FROTH_CELL_STRIP_TAG((val)) & 1) == 1)
 
 /* Wrap a raw arithmetic result to payload range with two's-complement
  * semantics. Operates in unsigned space to avoid C signed-overflow UB, then
@@ -204,3 +216,9 @@ froth_make_cell(froth_cell_t value, froth_cell_tag_t tag, froth_cell_t *out) {
 
 /* C function that implements a Froth word (kernel primitive or FFI binding). */
 typedef froth_error_t (*froth_native_word_t)(froth_vm_t *vm);
+
+/* Fast-path ABI for binary number words ( a b -- r ) (ADR-054). a and b are
+ * the untagged payloads; on success *result is the tagged result cell. No VM
+ * access, so the executor can run it on cells held in registers. */
+typedef froth_error_t (*froth_binop_t)(froth_cell_t a, froth_cell_t b,
+                                       froth_cell_t *result);
@@ -0,0 +1,237 @@
+#include "froth_verify.h"
+#include "froth_aot.h"
+#include "froth_body.h"
+#include "froth_fuse.h"
+#include "froth_primitives.h"
+#include "froth_slot_table.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* Depths are tracked relative to the entry depth and stored as bytes. */
+#define VERIFY_DEPTH_MAX 255
+
+/* Calls to quotation words are verified recursively, on the C stack. */
+#define VERIFY_NEST_MAX 8
+
+/* ds_peak: highest depth reached while the cell runs, relative to the depth
+ * before it. Only verified callees need it; for anything else the depth
+ * after the cell is the peak the executor can see. */
+typedef struct {
+  int ds_take, ds_give, ds_peak;
+  int rs_take, rs_give;
+} effect_t;
+
+/* Count the names in one "a b -- c" group. Returns false on "..." or a
+ * missing "--". *p is left after the closing ")". */
+static bool parse_group(const char **p, int *take, int *give) {
+  int *count = take;
+  bool seen_dashes = false;
+  const char *s = *p;
+
+  *take = 0;
+  *give = 0;
+  for (;;) {
+    while (*s == ' ')
+      s++;
+    if (*s == ')')
+      break;
+    if (*s == '\0')
+      return false;
+
+    const char *word = s;
+    while (*s != ' ' && *s != ')' && *s != '\0')
+      s++;
+    size_t len = (size_t)(s - word);
+
+    if (len == 2 && memcmp(word, "--", 2) == 0) {
+      if (seen_dashes)
+        return false;
+      seen_dashes = true;
+      count = give;
+    } else if (len >= 3 && memcmp(word, "...", 3) == 0) {
+      return false;
+    } else {
+      (*count)++;
+    }
+  }
+  *p = s + 1;
+  return seen_dashes;
+}
+
+/* Parse "( a b -- c )" with an optional "( R: a -- b )" group after it. */
+static bool parse_effect(const char *decl, effect_t *effect) {
+  const char *p = decl;
+
+  effect->ds_peak = 0;
+  effect->rs_take = 0;
+  effect->rs_give = 0;
+  while (*p == ' ')
+    p++;
+  if (*p++ != '(')
+    return false;
+  if (!parse_group(&p, &effect->ds_take, &effect->ds_give))
+    return false;
+
+  while (*p == ' ')
+    p++;
+  if (*p == '\0')
+    return true;
+  if (strncmp(p, "( R:", 4) != 0)
+    return false;
+  p += 4;
+  return parse_group(&p, &effect->rs_take, &effect->rs_give);
+}
+
+/* Declared effect of a kernel primitive. Only the kernel table and compiled
+ * words whose body the build checked (ADR-056) are trusted: the executor
+ * skips checks on the strength of these declarations. Control words and
+ * perm (handled at its call site) have no fixed effect. def and
+ * dangerous-reset can rebind the words a verified caller relies on while it
+ * runs. */
+static bool prim_effect(froth_native_word_t prim, effect_t *effect) {
+  if (froth_prim_code(prim) != FROTH_CODE_PRIM || prim == froth_prim_perm ||
+      prim == froth_prim_def || prim == froth_prim_dangerous_reset)
+    return false;
+  for (const froth_ffi_entry_t *e = froth_primitives; e->name != NULL; e++) {
+    if (e->word == prim)
+      return e->stack_effect != NULL && parse_effect(e->stack_effect, effect);
+  }
+  if (froth_aot_is_exact(prim)) {
+    const froth_ffi_entry_t *e = froth_ffi_find_entry(prim);
+    return e != NULL && parse_effect(e->stack_effect, effect);
+  }
+  return false;
+}
+
+/* The two cells before the one being checked, oldest first. */
+typedef struct {
+  froth_cell_t cells[2];
+  froth_cell_u_t count;
+} recent_t;
+
+/* `n pat perm` with both operands literal: ( n cells n pat -- len cells ). */
+static bool perm_effect(froth_vm_t *vm, const recent_t *recent,
+                        effect_t *effect) {
+  if (recent->count < 2)
+    return false;
+  froth_cell_t n_cell = recent->cells[0];
+  froth_cell_t pat_cell = recent->cells[1];
+  if (!FROTH_CELL_IS_NUMBER(n_cell) || !FROTH_CELL_IS_PATTERN(pat_cell))
+    return false;
+  froth_cell_t n = FROTH_CELL_STRIP_TAG(n_cell);
+  if (n < 0 || n > FROTH_MAX_PERM_SIZE)
+    return false;
+
+  const uint8_t *pattern = &vm->heap.data[FROTH_CELL_STRIP_TAG(pat_cell)];
+  for (uint8_t i = 0; i < pattern[0]; i++) {
+    if (pattern[1 + i] >= n)
+      return false;
+  }
+  *effect = (effect_t){2 + (int)n, pattern[0], 0, 0, 0};
+  return true;
+}
+
+static bool verify(froth_vm_t *vm, froth_cell_u_t slot_index, int nest);
+
+/* Effect of one body cell. Fused cells are verified as the cells they
+ * replace: that is what runs when a fused op's guard fails, and its peak is
+ * never lower. */
+static bool cell_effect(froth_vm_t *vm, froth_cell_t cell,
+                        const recent_t *recent, int nest, effect_t *effect) {
+  cell = froth_fuse_original(cell);
+
+  switch (FROTH_CELL_GET_TAG(cell)) {
+  case FROTH_NUMBER:
+  case FROTH_QUOTE:
+  case FROTH_SLOT:
+  case FROTH_PATTERN:
+  case FROTH_BSTRING:
+    *effect = (effect_t){0, 1, 0, 0, 0};
+    return true;
+  case FROTH_CALL:
+    break;
+  default:
+    return false;
+  }
+
+  froth_cell_u_t callee_index = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(cell);
+  const froth_slot_t *callee = froth_slot_entry(callee_index);
+  switch (callee->code) {
+  case FROTH_CODE_VALUE:
+    *effect = (effect_t){0, 1, 0, 0, 0};
+    return true;
+  case FROTH_CODE_PRIM:
+  case FROTH_CODE_BINOP:
+    if (callee->prim == froth_prim_perm)
+      return perm_effect(vm, recent, effect);
+    return prim_effect(callee->prim, effect);
+  case FROTH_CODE_QUOTE:
+    if (!verify(vm, callee_index, nest + 1))
+      return false;
+    *effect = (effect_t){callee->ds_in, callee->ds_out, callee->ds_peak, 0, 0};
+    return true;
+  default:
+    return false;
+  }
+}
+
+/* Returns true if the slot is verified. Words nested deeper than
+ * VERIFY_NEST_MAX are left unknown rather than rejected, so they can still
+ * verify when called on their own. */
+static bool verify(froth_vm_t *vm, froth_cell_u_t slot_index, int nest) {
+  froth_slot_t *slot = &slot_table[slot_index];
+  if (slot->verify != FROTH_VERIFY_UNKNOWN)
+    return slot->verify == FROTH_VERIFY_OK;
+  if (nest > VERIFY_NEST_MAX)
+    return false;
+  /* Rejected until proven otherwise, which also rejects recursion. */
+  slot->verify = FROTH_VERIFY_REJECTED;
+  if (slot->code != FROTH_CODE_QUOTE)
+    return false;
+
+  froth_cell_u_t offset = (froth_cell_u_t)FROTH_CELL_STRIP_TAG(slot->impl);
+  froth_cell_u_t length = froth_body_length(&vm->heap, offset);
+  recent_t recent = {{0, 0}, 0};
+  int ds = 0, ds_in = 0, ds_peak = 0;
+  int rs = 0;
+
+  for (froth_cell_u_t ip = 1; ip <= length;) {
+    effect_t effect;
+    froth_cell_t cell = froth_body_next(&vm->heap, offset, &ip);
+    if (!cell_effect(vm, cell, &recent, nest, &effect))
+      return false;
+    recent.cells[0] = recent.cells[1];
+    recent.cells[1] = cell;
+    recent.count++;
+
+    if (ds + effect.ds_peak > ds_peak)
+      ds_peak = ds + effect.ds_peak;
+    ds -= effect.ds_take;
+    if (-ds > ds_in)
+      ds_in = -ds;
+    ds += effect.ds_give;
+    if (ds > ds_peak)
+      ds_peak = ds;
+
+    /* The RS must stay balanced within the word and never reach into the
+     * caller's cells. */
+    rs -= effect.rs_take;
+    if (rs < 0)
+      return false;
+    rs += effect.rs_give;
+  }
+
+  if (rs != 0 || ds_in > VERIFY_DEPTH_MAX || ds_peak > VERIFY_DEPTH_MAX ||
+      ds_in + ds > VERIFY_DEPTH_MAX)
+    return false;
+
+  slot->ds_in = (uint8_t)ds_in;
+  slot->ds_out = (uint8_t)(ds_in + ds);
+  slot->ds_peak = (uint8_t)ds_peak;
+  slot->verify = FROTH_VERIFY_OK;
+  return true;
+}
+
+void froth_verify_slot(froth_vm_t *vm, froth_cell_u_t slot_index) {
+  verify(vm, slot_index, 0);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "froth_types.h"
+#include "froth_vm.h"
+
+/* Static stack-effect verification (ADR-055).
+ *
+ * Infers the DS effect of a quotation word from its body: literals push one
+ * cell, kernel primitives use their declared stack effect, `n pat perm` uses
+ * the pattern, and fused cells the cells they replace. A call to another
+ * quotation word verifies that word first, recursively, and uses its
+ * result. Callees are followed at most VERIFY_NEST_MAX (8) levels deep: a
+ * deeper callee is left unknown, to verify when it is called itself, and
+ * the words above it are rejected. Anything else (recursion, control words,
+ * FFI words, unparseable declarations) rejects the word. The result lives
+ * in the slot (verify, ds_in, ds_out, ds_peak) and is reset whenever the
+ * slot or any prim binding changes.
+ *
+ * The executor checks a verified word's depth once on entry and then runs
+ * its literals and FROTH_CODE_BINOP cells without per-operation bounds
+ * checks. */
+
+#ifdef FROTH_STACK_VERIFY
+
+/* Verify the word in slot_index and record the result in its slot. Cheap
+ * to call again: a known result is left as is. */
+void froth_verify_slot(froth_vm_t *vm, froth_cell_u_t slot_index);
+
+#else /* !FROTH_STACK_VERIFY */
+
+static inline void froth_verify_slot(froth_vm_t *vm,
+                                     froth_cell_u_t slot_index) {
+  (void)vm;
+  (void)slot_index;
+}
+
+#endif /* FROTH_STACK_VERIFY */
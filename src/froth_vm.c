@@ -7,6 +7,7 @@ static froth_cell_t ds_memory[FROTH_DS_CAPACITY];
 static froth_cell_t rs_memory[FROTH_RS_CAPACITY];
 static froth_cs_frame_t cs_memory[FROTH_CS_CAPACITY];
 static uint8_t heap_memory[FROTH_HEAP_SIZE];
+static froth_cell_t arena_memory[FROTH_ARENA_DEPTH];
 
 froth_vm_t froth_vm = {
     .ds = {.pointer = 0, .capacity = FROTH_DS_CAPACITY, .data = ds_memory},
@@ -17,7 +18,12 @@ froth_vm_t froth_vm = {
     .thrown = FROTH_OK,
     .last_error_slot = -1,
     .interrupted = 0,
+    .safepoint_budget = 0,
     .boot_complete = 0,
     .watermark_heap_offset = 0,
-    .mark_offset = (froth_cell_u_t)-1,
+    .arenas = {.pointer = 0,
+               .capacity = FROTH_ARENA_DEPTH,
+               .data = arena_memory},
+    .gc_trigger = 0,
+    .gc_hold = 0,
 };
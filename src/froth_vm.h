@@ -5,6 +5,10 @@
 #include "froth_tbuf.h"
 #include <stdbool.h>
 
+#ifndef FROTH_ARENA_DEPTH
+#define FROTH_ARENA_DEPTH 8
+#endif
+
 struct froth_vm_t {
   froth_stack_t ds;
   froth_stack_t rs;
@@ -14,11 +18,14 @@ struct froth_vm_t {
   froth_cell_t thrown;
   froth_cell_t last_error_slot; /* slot index at point of error, or -1 */
   volatile int interrupted;
+  froth_cell_u_t safepoint_budget; /* cells until the next console poll */
   uint8_t boot_complete;
   froth_cell_u_t
       trampoline_depth; /* C-level re-entry count for froth_execute_quote */
   froth_cell_u_t watermark_heap_offset;
-  froth_cell_u_t mark_offset;
+  froth_stack_t arenas; /* heap.pointer at each open arena{ (ADR-060) */
+  froth_cell_u_t gc_trigger; /* heap.pointer at which a collection is due */
+  froth_cell_u_t gc_hold;    /* native callers holding heap offsets (ADR-059) */
 };
 
 extern froth_vm_t froth_vm;
@@ -0,0 +1,170 @@
+#include "froth_vocab.h"
+#include "froth_fmt.h"
+#include "froth_reader.h"
+#include "froth_slot_table.h"
+#include "froth_stack.h"
+#include "froth_tbuf.h"
+#include <string.h>
+
+typedef char vocab_name_t[FROTH_VOCAB_NAME_MAX + 1];
+
+/* order[0] is searched first. An empty name is forth. */
+static vocab_name_t order[FROTH_VOCAB_ORDER_MAX];
+static froth_cell_u_t order_count;
+static vocab_name_t current;
+
+/* Length of the vocabulary part of a qualified name of len bytes, or 0 if
+ * it has none. The separator is the first dot that neither starts nor ends
+ * the name, so `.`, `.s` and `s.` stay in forth. */
+static size_t vocab_length(const char *name, size_t len) {
+  const char *dot = len > 1 ? memchr(name + 1, '.', len - 1) : NULL;
+  if (dot == NULL || dot == name + len - 1)
+    return 0;
+  return (size_t)(dot - name);
+}
+
+static froth_error_t qualify(char *out, size_t *out_len, const char *vocab,
+                             const char *name, size_t name_len) {
+  size_t vocab_len = strlen(vocab);
+  if (name_len >= FROTH_TOKEN_NAME_MAX)
+    return FROTH_ERROR_TOKEN_TOO_LONG;
+  memcpy(out, vocab, vocab_len);
+  out[vocab_len] = '.';
+  memcpy(out + vocab_len + 1, name, name_len);
+  *out_len = vocab_len + 1 + name_len;
+  return FROTH_OK;
+}
+
+froth_error_t froth_vocab_find(const char *name, size_t len,
+                               froth_cell_u_t *slot_index) {
+  char qualified[FROTH_VOCAB_NAME_MAX + 1 + FROTH_TOKEN_NAME_MAX];
+  size_t qualified_len;
+
+  for (froth_cell_u_t i = 0; i < order_count; i++) {
+    if (qualify(qualified, &qualified_len, order[i], name, len) == FROTH_OK &&
+        froth_slot_find_span(qualified, qualified_len, slot_index) ==
+            FROTH_OK)
+      return FROTH_OK;
+  }
+  return froth_slot_find_span(name, len, slot_index);
+}
+
+froth_error_t froth_vocab_find_or_create(froth_heap_t *heap, const char *name,
+                                         size_t len,
+                                         froth_cell_u_t *slot_index) {
+  char qualified[FROTH_VOCAB_NAME_MAX + 1 + FROTH_TOKEN_NAME_MAX];
+  size_t qualified_len;
+
+  froth_error_t err = froth_vocab_find(name, len, slot_index);
+  if (err != FROTH_ERROR_UNDEFINED_WORD)
+    return err;
+  /* An already qualified name is created as written. */
+  if (current[0] == '\0' || vocab_length(name, len) > 0)
+    return froth_slot_create_span(name, len, heap, slot_index);
+  FROTH_TRY(qualify(qualified, &qualified_len, current, name, len));
+  return froth_slot_create_span(qualified, qualified_len, heap, slot_index);
+}
+
+froth_error_t froth_vocab_define(froth_heap_t *heap, const char *name,
+                                 size_t len, froth_cell_u_t *slot_index) {
+  char qualified[FROTH_VOCAB_NAME_MAX + 1 + FROTH_TOKEN_NAME_MAX];
+  size_t qualified_len;
+
+  /* Not through the search order: the name is the current vocabulary's,
+   * even if another vocabulary or forth has one like it. */
+  if (current[0] != '\0' && vocab_length(name, len) == 0) {
+    FROTH_TRY(qualify(qualified, &qualified_len, current, name, len));
+    name = qualified;
+    len = qualified_len;
+  }
+  froth_error_t err = froth_slot_find_span(name, len, slot_index);
+  if (err != FROTH_ERROR_UNDEFINED_WORD)
+    return err;
+  return froth_slot_create_span(name, len, heap, slot_index);
+}
+
+void froth_vocab_reset(void) {
+  order_count = 0;
+  current[0] = '\0';
+}
+
+/* Pop a vocabulary name string. "forth" comes back empty. */
+static froth_error_t pop_vocab_name(froth_vm_t *vm, vocab_name_t out) {
+  froth_cell_t cell;
+  froth_bstring_view_t view;
+
+  FROTH_TRY(froth_stack_pop(&vm->ds, &cell));
+  if (!FROTH_CELL_IS_BSTRING(cell))
+    return FROTH_ERROR_TYPE_MISMATCH;
+  FROTH_TRY(froth_bstring_resolve(vm, cell, &view));
+  if (view.len < 1 || view.len > FROTH_VOCAB_NAME_MAX ||
+      memchr(view.data, '.', (size_t)view.len) != NULL)
+    return FROTH_ERROR_BOUNDS;
+  memcpy(out, view.data, (size_t)view.len);
+  out[view.len] = '\0';
+  if (strcmp(out, "forth") == 0)
+    out[0] = '\0';
+  return FROTH_OK;
+}
+
+/* Put a vocabulary first in the search order, moving it if present. */
+static froth_error_t use_vocab(const vocab_name_t name) {
+  froth_cell_u_t at = order_count;
+
+  if (name[0] == '\0')
+    return FROTH_OK; /* forth is always searched last */
+  for (froth_cell_u_t i = 0; i < order_count; i++) {
+    if (strcmp(order[i], name) == 0)
+      at = i;
+  }
+  if (at == order_count) {
+    if (order_count == FROTH_VOCAB_ORDER_MAX)
+      return FROTH_ERROR_BOUNDS;
+    order_count++;
+  }
+  memmove(order[1], order[0], at * sizeof(vocab_name_t));
+  memcpy(order[0], name, sizeof(vocab_name_t));
+  return FROTH_OK;
+}
+
+/* ( s -- ) New names go into vocabulary s, which is also searched first. */
+froth_error_t froth_prim_vocab(froth_vm_t *froth_vm) {
+  vocab_name_t name;
+
+  FROTH_TRY(pop_vocab_name(froth_vm, name));
+  FROTH_TRY(use_vocab(name));
+  memcpy(current, name, sizeof(vocab_name_t));
+  return FROTH_OK;
+}
+
+/* ( s -- ) Search vocabulary s first. */
+froth_error_t froth_prim_using(froth_vm_t *froth_vm) {
+  vocab_name_t name;
+
+  FROTH_TRY(pop_vocab_name(froth_vm, name));
+  return use_vocab(name);
+}
+
+/* ( -- ) Search and define in forth alone. */
+froth_error_t froth_prim_only(froth_vm_t *froth_vm) {
+  (void)froth_vm;
+  froth_vocab_reset();
+  return FROTH_OK;
+}
+
+/* ( s -- ) List the words of vocabulary s, without the prefix. */
+froth_error_t froth_prim_vocab_words(froth_vm_t *froth_vm) {
+  vocab_name_t name;
+  const char *word;
+
+  FROTH_TRY(pop_vocab_name(froth_vm, name));
+  size_t len = strlen(name);
+  for (froth_cell_u_t i = 0; i < froth_slot_count(); i++) {
+    if (froth_slot_get_name(i, &word) != FROTH_OK ||
+        vocab_length(word, strlen(word)) != len || strncmp(word, name, len) != 0)
+      continue;
+    FROTH_TRY(emit_string(len > 0 ? word + len + 1 : word));
+    FROTH_TRY(emit_string(" | "));
+  }
+  return emit_string("\n");
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "froth_heap.h"
+#include "froth_types.h"
+#include "froth_vm.h"
+#include <stddef.h>
+
+/* Vocabularies (ADR-068).
+ *
+ * A vocabulary is a name prefix: the word `read` in vocabulary `sensors`
+ * lives in the slot named `sensors.read`. The slot table and its name index
+ * (ADR-067) stay flat, and snapshots keep the qualified names as they are.
+ *
+ * Names the evaluator reads are looked up in each vocabulary of the search
+ * order, most recent first, and then as written, which is the root
+ * vocabulary `forth`. A name found nowhere is created in the current
+ * vocabulary. The name after ":" is always the current vocabulary's, so a
+ * definition shadows a word of the same name elsewhere instead of rebinding
+ * it. Lookups of kernel code, FFI registration and snapshot restore use the
+ * qualified names directly, through froth_slot_find_name. */
+
+/* Longest vocabulary name, without the dot. */
+#ifndef FROTH_VOCAB_NAME_MAX
+#define FROTH_VOCAB_NAME_MAX 15
+#endif
+
+/* Vocabularies in the search order, besides forth. */
+#ifndef FROTH_VOCAB_ORDER_MAX
+#define FROTH_VOCAB_ORDER_MAX 8
+#endif
+
+/* Resolve a name of len bytes through the search order. The name need not
+ * be NUL-terminated. */
+froth_error_t froth_vocab_find(const char *name, size_t len,
+                               froth_cell_u_t *slot_index);
+
+/* Resolve a name through the search order, or create it in the current
+ * vocabulary. */
+froth_error_t froth_vocab_find_or_create(froth_heap_t *heap, const char *name,
+                                         size_t len,
+                                         froth_cell_u_t *slot_index);
+
+/* The slot a definition of name binds: name in the current vocabulary,
+ * created if it doesn't exist yet. An already qualified name is taken as
+ * written. */
+froth_error_t froth_vocab_define(froth_heap_t *heap, const char *name,
+                                 size_t len, froth_cell_u_t *slot_index);
+
+/* Back to forth alone, as at boot. */
+void froth_vocab_reset(void);
+
+froth_error_t froth_prim_vocab(froth_vm_t *froth_vm);
+froth_error_t froth_prim_using(froth_vm_t *froth_vm);
+froth_error_t froth_prim_only(froth_vm_t *froth_vm);
+froth_error_t froth_prim_vocab_words(froth_vm_t *froth_vm);
@@ -13,6 +13,11 @@ bool platform_key_ready(void);
 void platform_check_interrupt(struct froth_vm_t *vm);
 void platform_delay_ms(froth_cell_u_t ms);
 uint32_t platform_uptime_ms(void);
+#ifdef FROTH_PROFILE
+/* Microsecond clock for the profiler (ADR-058). Wraps; only differences
+ * are used. */
+uint32_t platform_uptime_us(void);
+#endif
 
 _Noreturn void platform_fatal(void);
 
@@ -0,0 +1,226 @@
+// Command live runs Froth source through a local POSIX binary in Live mode
+// and prints the console output. Used by tests/bench/run.sh to time the
+// executor while the console is attached (ADR-048), where every console
+// poll is a platform_key_ready() syscall.
+//
+//	go run tests/bench/live/main.go <froth-binary> < program.froth
+//
+// Each input line is sent as one EVAL_REQ. KEEPALIVE frames are sent while
+// an eval runs so the lease does not expire. Standalone (stdlib only) so it
+// runs without the tools/cli module.
+package main
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"hash/crc32"
+	"io"
+	"os"
+	"os/exec"
+	"strings"
+	"sync"
+	"time"
+)
+
+const (
+	headerSize   = 20
+	attachReq    = 0x03
+	attachRes    = 0x04
+	evalReq      = 0x0B
+	evalRes      = 0x0C
+	keepalive    = 0x0E
+	outputData   = 0x11
+	errorFrame   = 0xFF
+	sessionID    = 0xF0F0
+	bootPrompt   = "froth> "
+	keepaliveGap = 1500 * time.Millisecond
+)
+
+func cobsEncode(data []byte) []byte {
+	out := make([]byte, len(data)+len(data)/254+2)
+	wp, cp, code := 1, 0, byte(1)
+	for _, b := range data {
+		if b == 0 {
+			out[cp] = code
+			cp = wp
+			wp++
+			code = 1
+			continue
+		}
+		out[wp] = b
+		wp++
+		code++
+		if code == 0xFF {
+			out[cp] = code
+			cp = wp
+			wp++
+			code = 1
+		}
+	}
+	out[cp] = code
+	return out[:wp]
+}
+
+func cobsDecode(data []byte) []byte {
+	var out []byte
+	for i := 0; i < len(data); {
+		code := int(data[i])
+		if code == 0 || i+code > len(data) {
+			return nil
+		}
+		out = append(out, data[i+1:i+code]...)
+		i += code
+		if code < 0xFF && i < len(data) {
+			out = append(out, 0)
+		}
+	}
+	return out
+}
+
+func wireFrame(msgType byte, seq uint16, payload []byte) []byte {
+	frame := make([]byte, headerSize+len(payload))
+	frame[0], frame[1], frame[2], frame[3] = 'F', 'L', 2, msgType
+	binary.LittleEndian.PutUint64(frame[4:12], sessionID)
+	binary.LittleEndian.PutUint16(frame[12:14], seq)
+	binary.LittleEndian.PutUint16(frame[14:16], uint16(len(payload)))
+	copy(frame[headerSize:], payload)
+	crc := crc32.Update(crc32.ChecksumIEEE(frame[:16]), crc32.IEEETable, payload)
+	binary.LittleEndian.PutUint32(frame[16:20], crc)
+
+	wire := append([]byte{0}, cobsEncode(frame)...)
+	return append(wire, 0)
+}
+
+type device struct {
+	mu  sync.Mutex
+	in  io.Writer
+	out *bufio.Reader
+}
+
+func (d *device) send(msgType byte, seq uint16, payload []byte) error {
+	d.mu.Lock()
+	defer d.mu.Unlock()
+	_, err := d.in.Write(wireFrame(msgType, seq, payload))
+	return err
+}
+
+// recv returns the next well-formed frame, skipping Direct-mode text.
+func (d *device) recv() (byte, []byte, error) {
+	for {
+		if _, err := d.out.ReadBytes(0); err != nil {
+			return 0, nil, err
+		}
+		body, err := d.out.ReadBytes(0)
+		if err != nil {
+			return 0, nil, err
+		}
+		if len(body) == 1 {
+			// Two delimiters in a row: the second opens the frame.
+			d.out.UnreadByte()
+			continue
+		}
+		frame := cobsDecode(body[:len(body)-1])
+		if len(frame) < headerSize || frame[0] != 'F' || frame[1] != 'L' {
+			continue
+		}
+		return frame[3], frame[headerSize:], nil
+	}
+}
+
+func run(binary string, lines []string) error {
+	cmd := exec.Command(binary)
+	stdin, err := cmd.StdinPipe()
+	if err != nil {
+		return err
+	}
+	stdout, err := cmd.StdoutPipe()
+	if err != nil {
+		return err
+	}
+	if err := cmd.Start(); err != nil {
+		return err
+	}
+	defer cmd.Process.Kill()
+
+	dev := &device{in: stdin, out: bufio.NewReader(stdout)}
+
+	// ATTACH is only accepted at the idle prompt, after the boot window.
+	var boot []byte
+	for !bytes.HasSuffix(boot, []byte(bootPrompt)) {
+		b, err := dev.out.ReadByte()
+		if err != nil {
+			return fmt.Errorf("waiting for prompt: %w", err)
+		}
+		boot = append(boot, b)
+	}
+	if err := dev.send(attachReq, 0, nil); err != nil {
+		return err
+	}
+	if msgType, payload, err := dev.recv(); err != nil {
+		return err
+	} else if msgType != attachRes || len(payload) < 1 || payload[0] != 0 {
+		return fmt.Errorf("attach refused")
+	}
+
+	done := make(chan struct{})
+	defer close(done)
+	go func() {
+		ticker := time.NewTicker(keepaliveGap)
+		defer ticker.Stop()
+		for {
+			select {
+			case <-done:
+				return
+			case <-ticker.C:
+				dev.send(keepalive, 0, nil)
+			}
+		}
+	}()
+
+	seq := uint16(1)
+	for _, line := range lines {
+		payload := []byte{0, byte(len(line)), byte(len(line) >> 8)}
+		if err := dev.send(evalReq, seq, append(payload, line...)); err != nil {
+			return err
+		}
+		for {
+			msgType, payload, err := dev.recv()
+			if err != nil {
+				return err
+			}
+			if msgType == outputData && len(payload) >= 2 {
+				os.Stdout.Write(payload[2:])
+				continue
+			}
+			if msgType == evalRes || msgType == errorFrame {
+				break
+			}
+		}
+		seq++
+	}
+	return nil
+}
+
+func main() {
+	if len(os.Args) != 2 {
+		fmt.Fprintln(os.Stderr, "usage: live <froth-binary> < program")
+		os.Exit(2)
+	}
+	source, err := io.ReadAll(os.Stdin)
+	if err != nil {
+		fmt.Fprintln(os.Stderr, err)
+		os.Exit(1)
+	}
+	var lines []string
+	for _, line := range strings.Split(string(source), "\n") {
+		if strings.TrimSpace(line) != "" {
+			lines = append(lines, line)
+		}
+	}
+	if err := run(os.Args[1], lines); err != nil {
+		fmt.Fprintln(os.Stderr, "live:", err)
+		os.Exit(1)
+	}
+}
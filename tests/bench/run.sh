@@ -0,0 +1,129 @@
+#!/bin/sh
+# Executor throughput benchmark.
+#
+# Builds each executor variant into a scratch directory, times a tight
+# `while` loop with the board's `millis` word, and reports cells/second.
+# Not part of `make test`: timings depend on the host.
+#
+#   BENCH_ITERATIONS  loop iterations per run (default 2000000)
+#   BENCH_RUNS        timed runs per variant, best is reported (default 3)
+#
+# The safe-point variants are also run in Live mode through
+# tests/bench/live (needs `go`; skipped otherwise). The JIT comparison runs
+# a second, word-heavy loop on x86-64 hosts, and the profiler variants
+# reuse it.
+set -eu
+
+SCRIPT_DIR=$(CDPATH= cd -- "$(dirname -- "$0")" && pwd)
+. "$SCRIPT_DIR/../kernel/harness.sh"
+
+BENCH_ITERATIONS=${BENCH_ITERATIONS:-2000000}
+BENCH_RUNS=${BENCH_RUNS:-3}
+
+# Cells executed per iteration of `[ dup 0 > ] [ 1 - ] while`:
+# cond is dup (call + `1 p[a a] perm`), 0, > = 6; body is 1, - = 2.
+# Counted as unfused source cells, so variants that dispatch fewer
+# cells for the same work (superinstructions) show as faster.
+BENCH_CELLS_PER_ITER=8
+BENCH_SETUP=
+BENCH_LOOP='[ dup 0 > ] [ 1 - ] while'
+
+bench_program() {
+  if [ -n "$BENCH_SETUP" ]; then
+    printf '%s\n' "$BENCH_SETUP"
+  fi
+  i=0
+  while [ "$i" -lt "$BENCH_RUNS" ]; do
+    printf '"elapsed:" s.emit millis %s %s drop millis swap - . cr\n' \
+      "$BENCH_ITERATIONS" "$BENCH_LOOP"
+    i=$((i + 1))
+  done
+}
+
+# bench_report <label> <output>: pick the best run and print cells/second.
+bench_report() {
+  label=$1
+  best=$(printf '%s\n' "$2" |
+    sed -n 's/^elapsed:\([0-9][0-9]*\) .*/\1/p' | sort -n | head -n 1)
+  if [ -z "$best" ]; then
+    fail "no timing reported for $label"
+  fi
+
+  awk -v label="$label" -v ms="$best" -v n="$BENCH_ITERATIONS" \
+    -v cpi="$BENCH_CELLS_PER_ITER" 'BEGIN {
+      if (ms < 1) ms = 1;
+      printf "%-18s %8d ms  %12.0f cells/s\n", label, ms, n * cpi * 1000 / ms
+    }'
+}
+
+# bench_variant <label> [cmake -D flags...]
+bench_variant() {
+  label=$1
+  shift
+  BENCH_BUILD_DIR="$HARNESS_TMP_ROOT/$label"
+
+  build_posix "$BENCH_BUILD_DIR" -DCMAKE_BUILD_TYPE=Release "$@" >/dev/null
+
+  FROTH_BINARY="$BENCH_BUILD_DIR/Froth" FROTH_TIMEOUT=300 run_froth "$(bench_program)"
+  bench_report "$label" "$LAST_OUTPUT"
+}
+
+# bench_live <label>: rerun the last bench_variant build in Live mode.
+bench_live() {
+  label=$1
+  if ! command -v go >/dev/null 2>&1; then
+    printf '%-18s skipped (go not found)\n' "$label"
+    return
+  fi
+
+  run_dir=$(new_test_workspace)
+  output=$(cd "$run_dir" && bench_program |
+    timeout 300 go run "$SCRIPT_DIR/live/main.go" "$BENCH_BUILD_DIR/Froth")
+  bench_report "$label" "$output"
+}
+
+printf 'iterations: %s x %s cells, best of %s\n' \
+  "$BENCH_ITERATIONS" "$BENCH_CELLS_PER_ITER" "$BENCH_RUNS"
+bench_variant lookup -DFROTH_DIRECT_THREADED=OFF -DFROTH_SUPERINSTRUCTIONS=OFF
+bench_variant cf-switch -DFROTH_DIRECT_THREADED=ON \
+  -DCMAKE_C_FLAGS=-DFROTH_NO_COMPUTED_GOTO -DFROTH_SUPERINSTRUCTIONS=OFF
+bench_variant cf-goto -DFROTH_DIRECT_THREADED=ON -DFROTH_SUPERINSTRUCTIONS=OFF
+bench_variant fused -DFROTH_DIRECT_THREADED=ON -DFROTH_SUPERINSTRUCTIONS=ON
+
+# Safe-point interval (ADR-052): 1 polls the console before every cell.
+bench_variant poll-every-cell -DFROTH_SAFEPOINT_INTERVAL=1
+bench_live poll-every-cell/live
+bench_variant safepoint-256 -DFROTH_SAFEPOINT_INTERVAL=256
+bench_live safepoint-256/live
+
+# Top-of-stack caching (ADR-054), with fusion and safe points at defaults.
+bench_variant tos-off -DFROTH_TOS_CACHE=OFF
+bench_variant tos-cache -DFROTH_TOS_CACHE=ON
+
+# Template JIT (ADR-057): interpreter against compiled code on a loop over
+# words from the kernel tests (test_executor.sh). Per iteration: the
+# condition as above (6) and `work` (53: the call, dup 4, poly 20, drop 4,
+# ar 18, drop 4, 1 -).
+BENCH_SETUP=': sq dup * ; : poly dup sq swap 3 * + 1 + ;
+: ar 7 3 - 2 * 5 + 6 and 1 or 3 xor 2 lshift 1 rshift ;
+: work dup poly drop ar drop 1 - ;'
+BENCH_LOOP='[ dup 0 > ] [ work ] while'
+BENCH_CELLS_PER_ITER=59
+
+printf 'iterations: %s x %s cells, best of %s\n' \
+  "$BENCH_ITERATIONS" "$BENCH_CELLS_PER_ITER" "$BENCH_RUNS"
+bench_variant interp-words -DFROTH_JIT=OFF
+case "$(uname -m)" in
+x86_64 | amd64) bench_variant jit-words -DFROTH_JIT=ON ;;
+*) printf '%-18s skipped (x86-64 only)\n' jit-words ;;
+esac
+
+# Collector (ADR-059): its check at each frame entry, against interp-words.
+bench_variant gc-off -DFROTH_GC=OFF
+
+# Profiler (ADR-058): compiled in but stopped, against interp-words above,
+# then running, which adds a clock read per word call.
+bench_variant prof-idle -DFROTH_PROFILE=ON
+BENCH_SETUP="$BENCH_SETUP
+prof.start"
+bench_variant prof-running -DFROTH_PROFILE=ON
@@ -0,0 +1,375 @@
+#!/bin/sh
+set -eu
+
+SCRIPT_DIR=$(CDPATH= cd -- "$(dirname -- "$0")" && pwd)
+. "$SCRIPT_DIR/harness.sh"
+
+EXECUTOR_PROGRAM="'v 42 def v
+: v 7 ; v
+: sq dup * ; : quad sq sq ; 3 quad
+: broken nosuch ; broken"
+
+# Every fused idiom (ADR-050), its display, and q@ recovering the original.
+FUSION_PROGRAM=": f dup + 1 + 2 - over over ; 1 5 f
+: g swap drop 3 < ; g
+: h 10 = ; 10 h
+'f see
+[ 1 + ] 0 q@ [ 1 + ] 1 q@
+: dup 99 ; 4 [ dup + ] call"
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$EXECUTOR_PROGRAM"
+assert_contains '[42 7 81]'
+assert_error 4
+assert_contains 'undefined word in "nosuch"'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$FUSION_PROGRAM"
+assert_contains '[1 9 1 9]'
+assert_contains '[1 9 0]'
+assert_contains '[1 9 0 -1]'
+assert_contains 'f |  | [dup + 1 + 2 - over over]'
+assert_contains '[1 9 0 -1 1 <s:+>]'
+assert_contains '[1 9 0 -1 1 <s:+> 103]'
+
+# Fused bodies are saved unfused and re-fused on restore.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ': inc 1 + ; : dbl dup + ; save'
+run_froth "20 inc dbl 'inc see"
+assert_contains '[42]'
+assert_contains 'inc |  | [1 +]'
+
+# Number words on literal operands fold as the body is built (ADR-073).
+# Calls through another slot, /mod and undefined shifts stay as written.
+FOLD_PROGRAM="[ 3 4 + 2 * ] [ 1 16 lshift ] [ 5 invert 1 [ 2 3 < ] ]
+[ dup 1 + ] [ 7 2 /mod ] [ 1 99 lshift ]
+: add + ; [ 3 4 add ] [ 3 4 '+ call ] dup call
+\"sensors\" vocab only : sensors.+ * ;
+\"sensors\" using [ 3 4 + ] call only [ 3 4 + ] call
+: k 2 3 * 1 + ; k 'k see"
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$FOLD_PROGRAM"
+assert_contains '[[14] [65536] [-6 1 [-1]]]'
+assert_contains '[dup 1 +] [7 2 /mod] [1 99 lshift]]'
+assert_contains "[3 4 add] [3 4 '+ call] 7]"
+assert_contains "'+ call] 7 12 7]"
+assert_contains 'k |  | [7]'
+
+# Tail calls reuse the caller's frame: 1000 levels is well past
+# FROTH_CS_CAPACITY, and the error still names the failing word.
+TAIL_PROGRAM=": down 1 - 100 over /mod drop drop down ; 1000 down
+: leak 1 >r ; : t leak ; t"
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$TAIL_PROGRAM"
+assert_contains 'division by zero in "/mod"'
+assert_not_contains 'error(18)'
+assert_error 15
+
+# while, catch and call run as CS frames (ADR-053): nesting them 100+ deep
+# no longer hits FROTH_REENTRY_DEPTH_MAX, and catch results are unchanged.
+# The stdlib combinators built on them nest as deep.
+CONTROL_PROGRAM=": dw dup 0 = [ drop ] [ 1 - [ 0 ] [ ] while dw ] if ; 150 dw
+: dc dup 0 = [ drop ] [ 1 - [ dc ] catch drop drop ] if ; 100 dc
+: dcall dup 0 = [ drop ] [ 1 - [ dcall ] call ] if ; 100 dcall
+: dd dup 0 = [ drop ] [ 1 - 0 [ dd ] dip drop ] if ; 100 dd
+: dt dup 0 = [ drop ] [ 1 - 1 [ dup dt ] times drop ] if ; 100 dt
+[ 1 2 + ] catch [ 5 throw ] catch [ [ 1 ] [ 1 ] while ] catch
+[ 1 >r ] catch [ 1 0 /mod ] catch"
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$CONTROL_PROGRAM"
+assert_not_contains 'error(18)'
+assert_contains '[3 0 -1 5 0 11 0]'
+assert_contains '[3 0 -1 5 0 11 0 15 0 5 0]'
+
+# Top-of-stack caching (ADR-054): inline binops keep the prims' error order,
+# and cached cells are spilled before prims, catch unwinding and overflow.
+# ar and cmp take an operand from the stack so that nothing folds (ADR-073).
+TOS_PROGRAM="[ + ] catch [ 1 [ ] + ] catch [ [ ] 1 + ] catch
+: ar 3 - 2 * 5 + 6 and 1 or 3 xor 2 lshift 1 rshift ; 7 ar
+: cmp 2 < swap 1 > rot 3 = ; 3 2 1 cmp
+: p 5 . 6 ; p 'p 1 [ + ] catch
+: fill 1 fill ; [ fill ] catch
+9 [ 1 \"x\" + ] catch [ \"x\" 1 + ] catch [ 1 [ 2 \"x\" + ] call ] catch"
+
+assert_tos_program() {
+  FROTH_RUN_DIR=$(new_test_workspace)
+  run_froth "$TOS_PROGRAM"
+  assert_contains '[2 0 3 0 3 0]'
+  assert_contains '[2 0 3 0 3 0 12 -1 -1 -1]'
+  assert_contains '5 [2 0 3 0 3 0 12 -1 -1 -1 6 <s:p> 1 3 0]'
+  assert_contains '[2 0 3 0 3 0 12 -1 -1 -1 6 <s:p> 1 3 0 1 0]'
+  assert_contains '[2 0 3 0 3 0 12 -1 -1 -1 6 <s:p> 1 3 0 1 0 9 3 0 3 0 3 0]'
+}
+
+assert_tos_program
+
+# Stack-effect verification (ADR-055): verified words are checked once on
+# entry. A failed entry check runs them checked, with the usual errors, and
+# redefining a callee re-verifies its callers.
+F8="f8 f8 f8 f8 f8 f8 f8 f8 f8 f8 f8 f8 f8 f8 f8 f8"
+VERIFY_PROGRAM=": sq dup * ; [ sq ] catch [ 'x sq ] catch
+: poly dup sq swap 3 * + 1 + ; 'poly see 5 poly
+: f8 1 1 1 1 1 1 1 1 ; [ $F8 $F8 f8 ] catch
+: bad 1 >r ; 'bad see
+: dup 1 2 ; 'sq see 3 sq"
+
+assert_verify_program() {
+  FROTH_RUN_DIR=$(new_test_workspace)
+  run_froth "$VERIFY_PROGRAM"
+  assert_contains '[2 0 3 0]'
+  assert_contains 'user-defined | verified ( 1 -- 1 )'
+  assert_contains '[2 0 3 0 41 1 0]'
+  assert_not_contains 'verified ( 1 -- 0 )'
+  assert_contains 'user-defined | verified ( 0 -- 1 )'
+  assert_contains '[2 0 3 0 41 1 0 3 2]'
+}
+
+assert_verify_program
+
+# Build-time compiled words (ADR-056) behave like the stdlib quotations they
+# replace, verify as callees, and stay redefinable. The same program runs
+# with nothing compiled.
+AOT_PROGRAM="1 2 3 rot -rot nip tuck .s
+1 2 [ 10 + ] dip 5 [ 2 * ] keep 5 [ 2 * ] [ 1 + ] bi .s
+3 [ 42 . ] times 7 negate .s
+'tuck see
+: f rot + ; 'f see
+[ 1 [ drop drop ] times ] catch .s
+: rot 99 ; 1 rot .s"
+
+assert_aot_program() {
+  FROTH_RUN_DIR=$(new_test_workspace)
+  run_froth "$AOT_PROGRAM"
+  assert_contains '[3 1 3]'
+  assert_contains '[3 1 3 11 2 10 5 10 6]'
+  assert_contains '42 42 42 [3 1 3 11 2 10 5 10 6 -7]'
+  assert_contains 'user-defined | verified ( 3 -- 2 )'
+  assert_contains '[3 1 3 11 2 10 5 10 6 -7 11 0]'
+  assert_contains '[3 1 3 11 2 10 5 10 6 -7 11 0 1 99]'
+}
+
+assert_aot_program
+assert_contains 'Compiled from core.froth | primitive'
+
+AOT_OFF_BUILD_DIR=$(new_test_workspace)
+build_posix "$AOT_OFF_BUILD_DIR" -DFROTH_AOT_WORDS=
+FROTH_BINARY="$AOT_OFF_BUILD_DIR/Froth"
+assert_aot_program
+assert_contains 'tuck |  | [2 p[a b a] perm]'
+unset FROTH_BINARY
+
+TOS_OFF_BUILD_DIR=$(new_test_workspace)
+build_posix "$TOS_OFF_BUILD_DIR" -DFROTH_TOS_CACHE=OFF
+FROTH_BINARY="$TOS_OFF_BUILD_DIR/Froth"
+assert_tos_program
+assert_verify_program
+
+# Same programs with the prim/impl lookup path and no fusion.
+LOOKUP_BUILD_DIR=$(new_test_workspace)
+build_posix "$LOOKUP_BUILD_DIR" -DFROTH_DIRECT_THREADED=OFF \
+  -DFROTH_SUPERINSTRUCTIONS=OFF
+FROTH_BINARY="$LOOKUP_BUILD_DIR/Froth"
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$EXECUTOR_PROGRAM"
+assert_contains '[42 7 81]'
+assert_error 4
+assert_contains 'undefined word in "nosuch"'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$FUSION_PROGRAM"
+assert_contains '[1 9 0 -1]'
+assert_contains 'f |  | [dup + 1 + 2 - over over]'
+assert_contains '[1 9 0 -1 1 <s:+> 103]'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$TAIL_PROGRAM"
+assert_contains 'division by zero in "/mod"'
+assert_not_contains 'error(18)'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$CONTROL_PROGRAM"
+assert_not_contains 'error(18)'
+assert_contains '[3 0 -1 5 0 11 0 15 0 5 0]'
+
+assert_tos_program
+assert_verify_program
+
+# Template JIT (ADR-057), x86-64 hosts only. With a threshold of 1 every
+# word is compiled on its first call, so the shared programs run compiled.
+# Code compiled before a redefinition falls back to the interpreter, also
+# when the body itself rebinds a word it calls next.
+JIT_PROGRAM=": inc 1 + ; : w inc inc ; 0 w w w .s
+: inc 10 + ; w .s
+: r 'inc [ 100 + ] def inc ; 0 r .s
+: deep 1 deep ; [ deep ] catch .s"
+
+case "$(uname -m)" in
+x86_64 | amd64)
+  JIT_BUILD_DIR=$(new_test_workspace)
+  build_posix "$JIT_BUILD_DIR" -DFROTH_JIT=ON -DFROTH_JIT_THRESHOLD=1
+  FROTH_BINARY="$JIT_BUILD_DIR/Froth"
+
+  FROTH_RUN_DIR=$(new_test_workspace)
+  run_froth "$JIT_PROGRAM"
+  assert_contains '[6]'
+  assert_contains '[26]'
+  assert_contains '[26 100]'
+  assert_contains '[26 100 1 0]'
+
+  FROTH_RUN_DIR=$(new_test_workspace)
+  run_froth "$EXECUTOR_PROGRAM"
+  assert_contains '[42 7 81]'
+  assert_contains 'undefined word in "nosuch"'
+
+  FROTH_RUN_DIR=$(new_test_workspace)
+  run_froth "$TAIL_PROGRAM"
+  assert_contains 'division by zero in "/mod"'
+  assert_not_contains 'error(18)'
+
+  FROTH_RUN_DIR=$(new_test_workspace)
+  run_froth "$CONTROL_PROGRAM"
+  assert_not_contains 'error(18)'
+  assert_contains '[3 0 -1 5 0 11 0 15 0 5 0]'
+
+  assert_tos_program
+  assert_verify_program
+  assert_aot_program
+  ;;
+esac
+unset FROTH_BINARY
+
+# Profiler (ADR-058): calls per word across recursion and stdlib
+# callers, and a clean shadow stack through tail calls, catch and errors.
+PROFILE_PROGRAM=": sq dup * ; : r dup 0 > [ 1 - r ] [ ] if ;
+prof.start 100 [ 5 sq drop ] times 50 r drop prof.stop prof.report
+prof.reset prof.report"
+
+PROFILE_BUILD_DIR=$(new_test_workspace)
+build_posix "$PROFILE_BUILD_DIR" -DFROTH_PROFILE=ON
+FROTH_BINARY="$PROFILE_BUILD_DIR/Froth"
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$PROFILE_PROGRAM"
+assert_contains 'sq | quote | 100 |'
+assert_contains 'r | quote | 51 |'
+assert_contains 'times | quote | 1 |'
+assert_contains 'prims: 0 calls 0 us | quotes: 0 calls 0 us | elapsed: 0 us'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "prof.start
+$TAIL_PROGRAM
+prof.report"
+assert_contains 'division by zero in "/mod"'
+assert_contains 'down | quote | 1000 |'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "prof.start
+$CONTROL_PROGRAM
+prof.report"
+assert_contains '[3 0 -1 5 0 11 0 15 0 5 0]'
+assert_contains 'dc | quote | 101 |'
+unset FROTH_BINARY
+
+# Compact quotation bodies (ADR-062): the same programs on byte-code
+# bodies, wide literals, q@ and q.len, and a smaller user heap. Folding is
+# off so that "big" keeps its wide literals.
+COMPACT_PROGRAM=": big 100000 -70000 + ;
+: w 3 [ 7 drop ] times \"s\" s.emit 1 2 2 p[ b a ] perm big [ -16 47 48 ] 2 q@ ;
+w .s
+'big see
+[ 1 big -200 ] q.len .
+info save"
+
+COMPACT_BUILD_DIR=$(new_test_workspace)
+build_posix "$COMPACT_BUILD_DIR" -DFROTH_COMPACT_QUOTES=ON \
+  -DFROTH_SUPERINSTRUCTIONS=OFF -DFROTH_CONST_FOLD=OFF
+FROTH_BINARY="$COMPACT_BUILD_DIR/Froth"
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$COMPACT_PROGRAM"
+assert_contains 's[1 2 30000 48]'
+assert_contains 'big |  | [100000 -70000 +]'
+assert_contains '3 [1 2 30000 48]'
+assert_contains '(91 user)'
+run_froth 'w .s'
+assert_contains 's[1 2 30000 48]'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$EXECUTOR_PROGRAM"
+assert_contains '[42 7 81]'
+assert_contains 'undefined word in "nosuch"'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$TAIL_PROGRAM"
+assert_contains 'division by zero in "/mod"'
+assert_not_contains 'error(18)'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "$CONTROL_PROGRAM"
+assert_contains '[3 0 -1 5 0 11 0 15 0 5 0]'
+assert_verify_program
+unset FROTH_BINARY
+
+# Quotations build in one pass over nested bodies; the DS holds the body
+# cells only while they are read.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth '5 [ 1 [ 2 [ 3 ] "s" ] p[ b a ] 4 ]
+1 2 [ [ [ 2 p[ a b ] perm ] call ] call ] call'
+assert_contains '[5 [1 [2 [3] "s"] p[b a] 4]]'
+assert_contains '[5 [1 [2 [3] "s"] p[b a] 4] 2 1]'
+
+# A body's cells must fit in the free DS, and bodies nest at most 16 deep.
+# Past either limit the build fails with its own error and the DS is kept.
+repeat_text() {
+  i=0
+  while [ "$i" -lt "$2" ]; do
+    printf '%s' "$1"
+    i=$((i + 1))
+  done
+}
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "7
+[ $(repeat_text '1 ' 300)]
+$(repeat_text '[ ' 16)$(repeat_text '] ' 16)drop
+$(repeat_text '[ ' 17)$(repeat_text '] ' 17)"
+assert_contains 'error(108): quotation too large for the data stack'
+assert_contains 'error(109): quotations nested too deep'
+assert_not_contains 'error(1):'
+assert_contains '[7]'
+
+# Safe points (ADR-052): with a long poll interval, Ctrl-C still stops a
+# tight loop, bare or inside times, and the REPL carries on.
+require_tool mkfifo
+require_tool pkill
+SAFEPOINT_BUILD_DIR=$(new_test_workspace)
+build_posix "$SAFEPOINT_BUILD_DIR" -DFROTH_SAFEPOINT_INTERVAL=4096
+
+SAFEPOINT_RUN_DIR=$(new_test_workspace)
+mkfifo "$SAFEPOINT_RUN_DIR/in"
+(cd "$SAFEPOINT_RUN_DIR" &&
+  timeout 10 "$SAFEPOINT_BUILD_DIR/Froth" <in >out 2>&1) &
+SAFEPOINT_PID=$!
+{
+  sleep 2
+  printf '[ -1 ] [ ] while\n'
+  sleep 1
+  pkill -INT -f "^$SAFEPOINT_BUILD_DIR/Froth$"
+  sleep 1
+  printf '7 .\n'
+  printf '200000000 [ ] times\n'
+  sleep 1
+  pkill -INT -f "^$SAFEPOINT_BUILD_DIR/Froth$"
+  sleep 1
+  printf '4242 .\n'
+  printf '\004'
+} >"$SAFEPOINT_RUN_DIR/in"
+wait "$SAFEPOINT_PID" || true
+LAST_OUTPUT=$(cat "$SAFEPOINT_RUN_DIR/out")
+assert_error 14
+assert_contains '7 '
+assert_contains '4242 '
@@ -0,0 +1,103 @@
+#!/bin/sh
+set -eu
+
+SCRIPT_DIR=$(CDPATH= cd -- "$(dirname -- "$0")" && pwd)
+. "$SCRIPT_DIR/harness.sh"
+
+# Redefining a word 200 times allocates about twice the heap.
+source=
+i=1
+while [ "$i" -le 200 ]; do
+  source="${source}: w $i 2 3 4 5 6 7 8 drop drop drop drop drop drop drop ;
+"
+  i=$((i + 1))
+done
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "${source}w ."
+assert_contains '200 []'
+assert_not_contains 'heap out of memory'
+
+# A running loop collects at frame entry; live objects survive the move.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "[ 1 0 ] pat 'sw swap def
+: nest [ 1 [ 2 3 ] ] ;
+: churn [ dup 0 > ] [ [ 0 1 ] pat drop 1 - ] while drop ;
+\"kept\" s.keep 3000 churn nest call call + + . 1 2 2 sw perm . . s.emit"
+assert_contains '6 2 1 kept[]'
+assert_not_contains 'heap out of memory'
+
+# gc collects before the next token.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ": w 1 ;
+: w 2 ;
+: w 3 ;
+info gc info w ."
+assert_contains '(40 user)'
+assert_contains '(12 user)'
+assert_contains '3 []'
+
+# A mark moves with the data it bounds.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ": w 1 ;
+: w 2 ;
+mark [ 7 ] 'k swap def gc info release info w ."
+assert_contains '(22 user)'
+assert_contains '(12 user)'
+assert_contains '2 []'
+
+# Arenas nest: the inner }arena keeps the outer arena's allocations.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "arena{ [ 1 2 ] pat drop arena{ [ 0 1 ] pat drop info }arena info }arena info"
+assert_contains '(43 user)'
+assert_contains '(27 user)
+slots: 85 / 128
+Froth v0.1.0 | 32-bit cells
+heap: 628 / 4096 bytes used (12 user)'
+
+# catch closes the arenas its body left open.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ": boom arena{ [ 0 1 ] pat drop 5 throw ;
+[ boom ] catch . . info
+[ arena{ arena{ arena{ arena{ arena{ arena{ arena{ arena{ arena{ ] catch . .
+}arena"
+assert_contains '0 5'
+assert_contains '(68 user)'
+assert_contains '0 24'
+assert_contains 'error(19): no mark set in "}arena"'
+
+# A word that returns without its }arena leaves the arena open, and what
+# follows is allocated in it, until a }arena or an unwinding catch closes it.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ": scratch arena{ [ 0 1 ] pat drop [ ] [ }arena ] if ;
+info -1 scratch info
+[ 0 1 ] pat drop info }arena info
+0 scratch }arena
+[ -1 scratch 5 throw ] catch . . info"
+assert_contains '(75 user)'
+assert_contains '(78 user)'
+assert_contains 'no mark set in "}arena"'
+assert_contains '0 5 '
+assert_contains '(92 user)'
+
+# Equal literals share one heap copy (ADR-061).
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "[ 1 2 3 ] [ 1 2 3 ] info
+: a \"hello\" s.emit p[ a b ] ; : b \"hello\" s.emit p[ a b ] ; info a b"
+assert_contains '(28 user)'
+assert_contains '(58 user)'
+assert_contains 'hellohello[[1 2 3] [1 2 3] p[a b] p[a b]]'
+
+# mem.stats (ADR-063): heap use by kind, high-water marks, and the bytes
+# a restore loaded.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ': w "hi" s.emit p[ a a ] [ 1 2 ] ;
+: drops dup 0 > [ 1 - swap drop drops ] [ drop ] if ;
+1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 38 39 40 40 drops
+"x" "y" drop drop mem.stats save'
+assert_contains 'heap: 1036 / 4096 bytes, high 1036'
+assert_contains 'restored 0 | names 625 | quotes 364 | patterns 14 | strings 7 | objects 0 | unreached 26'
+assert_contains 'ds: 0 / 256 cells, high 44'
+assert_contains 'tdesc: 2 / 32 strings, high 2'
+run_froth 'mem.stats'
+assert_contains 'restored 112 |'
@@ -0,0 +1,124 @@
+#!/bin/sh
+set -eu
+
+SCRIPT_DIR=$(CDPATH= cd -- "$(dirname -- "$0")" && pwd)
+. "$SCRIPT_DIR/harness.sh"
+
+# Arrays: element access, bulk operations and growth.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'a 4 arr.new def
+7 a 0 arr!
+a 9 arr.fill 5 a 3 arr!
+a 2 a 0 2 arr.copy
+a arr.len a 3 arr@ a 0 arr@
+0 a [ + ] arr.each
+a 6 arr.grow
+a 4 arr@"
+assert_contains '[4 5 9]'
+assert_contains '[4 5 9 28]'
+assert_contains '[4 5 9 28 arr[9 5 9 5 0 0]]'
+assert_error 13
+
+# The collector keeps and moves what arrays hold, through nested arrays.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ": w 1 ;
+: w 2 ;
+'inner 2 arr.new def
+[ 40 2 + ] inner 0 arr!
+\"kept\" inner 1 arr!
+'outer 1 arr.new def
+inner outer 0 arr!
+'inner 0 def
+gc
+outer 0 arr@ dup 0 arr@ call swap 1 arr@ s.emit"
+assert_contains 'kept[42]'
+
+# A snapshot keeps arrays bound to slots, cycles included.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'a 3 arr.new def
+[ 6 7 * ] a 0 arr!
+\"saved\" a 1 arr!
+a a 2 arr!
+save"
+assert_contains '[]'
+
+run_froth "a 2 arr@ 0 arr@ call a 1 arr@ s.emit a"
+assert_contains 'saved[42 arr[[42] "saved" <arr:3>]]'
+
+# An array kept past its arena (ADR-060) points at whatever is allocated
+# there next. Its header is checked against the heap before any body cell
+# is read, written, printed or collected.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'a 1 arr.new def
+arena{ 1 arr.new drop 3 arr.new a 0 arr! }arena
+[ 5 1000000 ] 'r swap def
+a 0 arr@ 200000 arr@
+7 a 0 arr@ 0 arr!
+: w 1 ; : w 2 ; gc
+w a 0 arr@"
+assert_contains 'error(13): index out of bounds in "arr@"'
+assert_contains 'error(13): index out of bounds in "arr!"'
+assert_contains '[2 <obj:?>]'
+
+# Maps: number and string keys, replace, delete, capacity.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'m 4 map.new def
+10 1 m map! 20 \"x\" m map! 30 1 m map!
+m map.len 1 m map@ \"x\" m map@ 2 m map?
+\"x\" m map.del 5 m map.del m map.len
+0 m [ nip + ] map.each
+'d 1 map.new def d \"self\" d map! d
+2 2 m map! 3 3 m map! 4 4 m map! 5 5 m map!"
+assert_contains '[2 30 20 0]'
+assert_contains '[2 30 20 0 1 30]'
+assert_contains '[2 30 20 0 1 30 map{"self":<map:1>}]'
+assert_error 13
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'m 2 map.new def 99 m map@"
+assert_error 25
+
+# Deleting shifts probe runs back; every remaining key stays reachable.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'m 40 map.new def
+0 [ dup 40 < ] [ dup dup 3 * swap m map! 1 + ] while drop
+0 [ dup 40 < ] [ dup m map.del 2 + ] while drop
+m map.len 0 m [ nip + ] map.each 7 m map@ 8 m map?"
+assert_contains '[20 1200 21 0]'
+
+# Maps survive a collection that moves them and a snapshot.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ": w 1 ;
+: w 2 ;
+'cfg 4 map.new def
+21 \"addr\" cfg map!
+\"fast\" \"mode\" cfg map!
+cfg 3 cfg map!
+gc
+save"
+assert_contains '[]'
+
+run_froth "\"addr\" cfg map@ \"mode\" cfg map@ s.emit 3 cfg map@ map.len"
+assert_contains 'fast[21 3]'
+
+# Rings keep the last n values; the aggregates read the whole window.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'r 3 ring.new def
+5 r ring.push -7 r ring.push 4 r ring.push 9 r ring.push r
+r ring.len r ring.peek r ring.sum r ring.min r ring.max r ring.avg
+r ring.pop r ring.pop r
+r ring.pop r ring.pop"
+assert_contains '[ring[-7 4 9]]'
+assert_contains '[ring[-7 4 9] 3 -7 6 -7 9 2]'
+assert_contains '[ring[9] 3 -7 6 -7 9 2 -7 4 ring[9]]'
+assert_error 13
+
+# The mean truncates toward zero; the window survives a snapshot.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'r 2 ring.new def
+-3 r ring.push -4 r ring.push
+save"
+assert_contains '[]'
+
+run_froth "r ring.avg 1 r ring.push r ring.avg r"
+assert_contains '[-3 -1 ring[-4 1]]'
@@ -17,6 +17,14 @@ assert_contains 'reset'
 run_froth 'saved-word'
 assert_error 4
 
+# Interned literals (ADR-061) shared by several words survive a round trip.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ': a "hi" s.emit [ 1 2 ] ; : b "hi" s.emit [ 1 2 ] ; save'
+assert_contains '[]'
+
+run_froth 'a b'
+assert_contains 'hihi[[1 2] [1 2]]'
+
 USER_PROGRAM_DIR=$(new_test_workspace)
 USER_PROGRAM_PATH="$USER_PROGRAM_DIR/user_program.froth"
 cat >"$USER_PROGRAM_PATH" <<'EOF'
@@ -32,3 +32,13 @@ FROTH_RUN_DIR=$(new_test_workspace)
 run_froth 'dangerous-reset
 "after-reset" s.emit'
 assert_contains 'after-reset[]'
+
+# The name index is rebuilt: names come back in new slots, in any order.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ': temp 42 ;
+: other 1 ;
+dangerous-reset
+: other 2 ;
+: temp 3 ;
+temp other'
+assert_contains '[3 2]'
@@ -0,0 +1,37 @@
+#!/bin/sh
+set -eu
+
+SCRIPT_DIR=$(CDPATH= cd -- "$(dirname -- "$0")" && pwd)
+. "$SCRIPT_DIR/harness.sh"
+
+# The REPL feeds each line to a resumable evaluator: definitions, bodies,
+# patterns, strings and comments carry over from one line to the next, and
+# the stack is shown once the expression is complete.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ': sq
+  dup * ;
+5 sq
+"two
+lines" s.len ( a comment
+over lines ) [ 1
+[ 2 ] ] p[ a
+b ]'
+assert_contains '.. '
+assert_contains '[25]'
+assert_contains '[25 9 [1 [2]] p[a b]]'
+
+# An error in a later line drops the whole expression.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth '7
+1 [ 2
+] ]
+8'
+assert_error 107
+assert_contains '[7 8]'
+assert_not_contains '[7 1'
+
+# A line longer than the line buffer is read in pieces.
+FROTH_RUN_DIR=$(new_test_workspace)
+long="0 $(printf '1 + %.0s' $(seq 400))"
+run_froth "$long"
+assert_contains '[400]'
@@ -41,3 +41,17 @@ FROTH_RUN_DIR=$(new_test_workspace)
 run_froth "$source"
 assert_contains 's1'
 assert_contains 's25'
+
+# Tokens are views into the input: escapes are decoded only when a literal
+# is stored, whether transient or in a quotation.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth '"<a\"b\\c>" s.emit [ "x\ty" ] call s.len "plain" s.len'
+assert_contains '<a"b\c>[3 5]'
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth '"bad\q"'
+assert_error 106
+
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth "'abcdefghijklmnopqrstuvwxyz012345"
+assert_error 100
@@ -0,0 +1,45 @@
+#!/bin/sh
+set -eu
+
+SCRIPT_DIR=$(CDPATH= cd -- "$(dirname -- "$0")" && pwd)
+. "$SCRIPT_DIR/harness.sh"
+
+# Words defined in a vocabulary resolve through the search order; forth is
+# searched last, and qualified names always work.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth '"sensors" vocab
+: read 42 ;
+: twice read read + ;
+only
+: read 7 ;
+read sensors.read sensors.twice
+"sensors" using read
+only read'
+assert_contains '[7 42 84]'
+assert_contains '[7 42 84 42]'
+assert_contains '[7 42 84 42 7]'
+
+# A definition goes into the current vocabulary and shadows a word of the
+# same name in forth, kernel words included, instead of rebinding it.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth ': read 7 ;
+"sensors" vocab : read 42 ; : dup 1 2 ; : + * ; read 5 dup 3 4 +
+only read 5 dup 3 4 + sensors.dup'
+assert_contains '[42 5 1 2 12]'
+assert_contains '[42 5 1 2 12 7 5 5 7 1 2]'
+
+# A dotted board or kernel prefix is a vocabulary too.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth '"arr" using 3 new len
+"sensors" vocab : read 1 ; : scale 2 ;
+"sensors" vocab.words'
+assert_contains '[3]'
+assert_contains 'read | scale | '
+
+# Qualified names are what a snapshot keeps.
+FROTH_RUN_DIR=$(new_test_workspace)
+run_froth '"sensors" vocab : read 42 ; save'
+assert_contains '[]'
+
+run_froth 'sensors.read "sensors" using read'
+assert_contains '[42 42]'
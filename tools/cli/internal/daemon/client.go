@@ -197,6 +197,30 @@ func (c *Client) Info() (*InfoResult, error) {
 	return &result, nil
 }
 
+func (c *Client) Profile() (*ProfileResult, error) {
+	raw, err := c.Call("profile", nil)
+	if err != nil {
+		return nil, err
+	}
+	var result ProfileResult
+	if err := json.Unmarshal(raw, &result); err != nil {
+		return nil, err
+	}
+	return &result, nil
+}
+
+func (c *Client) Mem() (*MemResult, error) {
+	raw, err := c.Call("mem", nil)
+	if err != nil {
+		return nil, err
+	}
+	var result MemResult
+	if err := json.Unmarshal(raw, &result); err != nil {
+		return nil, err
+	}
+	return &result, nil
+}
+
 func (c *Client) Reset() (*ResetResult, error) {
 	raw, err := c.Call("reset", nil)
 	if err != nil {
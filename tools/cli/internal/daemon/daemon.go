@@ -693,7 +693,7 @@ func (d *Daemon) handleFrame(cobsData []byte) {
 			})
 		}
 	case protocol.AttachRes, protocol.DetachRes,
-		protocol.EvalRes, protocol.InfoRes,
+		protocol.EvalRes, protocol.InfoRes, protocol.ProfRes, protocol.MemRes,
 		protocol.ResetRes, protocol.HelloRes, protocol.Error:
 		d.waiterMu.Lock()
 		ch := d.waiterCh
@@ -1160,6 +1160,7 @@ func (d *Daemon) waitResponseNoClear(ch chan frameResponse, timeout time.Duratio
 func (d *Daemon) deviceEval(source string, owner *rpcConn) (*EvalResult, error) {
 	d.portMu.Lock()
 	conn := d.conn
+	hello := d.hello
 	d.portMu.Unlock()
 	if conn == nil {
 		return nil, ErrDisconnected
@@ -1172,17 +1173,17 @@ func (d *Daemon) deviceEval(source string, owner *rpcConn) (*EvalResult, error)
 		return nil, fmt.Errorf("eval: %w", err)
 	}
 
-	chunks, err := session.ChunkEvalSource(source)
+	chunks, stream, err := session.EvalChunks(source, hello)
 	if err != nil {
 		return nil, err
 	}
 	var lastResult *EvalResult
 
-	for _, chunk := range chunks {
+	for i, chunk := range chunks {
 		seq := d.allocSeq()
 		d.beginActiveEval(seq, owner)
 
-		payload := protocol.BuildEvalPayload(chunk)
+		payload := protocol.BuildEvalPayload(chunk, stream && i < len(chunks)-1)
 
 		ch := d.registerWaiter(seq, protocol.EvalRes, true)
 		if err := d.sendFrame(protocol.EvalReq, seq, payload); err != nil {
@@ -1284,6 +1285,145 @@ func (d *Daemon) deviceInfo() (*InfoResult, error) {
 	}, nil
 }
 
+// deviceProfile reads the profiler counters page by page with PROF_REQ.
+// Only FROTH_PROFILE builds answer it; others reply with ERROR.
+func (d *Daemon) deviceProfile() (*ProfileResult, error) {
+	d.portMu.Lock()
+	conn := d.conn
+	d.portMu.Unlock()
+	if conn == nil {
+		return nil, ErrDisconnected
+	}
+
+	d.reqMu.Lock()
+	defer d.reqMu.Unlock()
+
+	if err := d.attach(); err != nil {
+		return nil, fmt.Errorf("profile: %w", err)
+	}
+
+	result := &ProfileResult{Words: []ProfileWord{}}
+	var next uint16
+	for {
+		seq := d.allocSeq()
+		ch := d.registerWaiter(seq, protocol.ProfRes, false)
+		if err := d.sendFrame(protocol.ProfReq, seq, protocol.BuildProfilePayload(next)); err != nil {
+			d.clearWaiter()
+			return nil, fmt.Errorf("write: %w", err)
+		}
+
+		header, respPayload, err := d.waitResponse(ch, commandTimeout)
+		if err != nil {
+			return nil, err
+		}
+
+		if header.MessageType == protocol.Error {
+			errResp, parseErr := protocol.ParseErrorResponse(respPayload)
+			if parseErr != nil {
+				return nil, parseErr
+			}
+			return nil, fmt.Errorf("device error (cat %d): %s", errResp.Category, errResp.Detail)
+		}
+
+		if header.MessageType != protocol.ProfRes {
+			return nil, fmt.Errorf("unexpected response type: 0x%02x", header.MessageType)
+		}
+
+		resp, err := protocol.ParseProfileResponse(respPayload)
+		if err != nil {
+			return nil, err
+		}
+
+		result.Active = resp.Active
+		result.ElapsedUs = int(resp.ElapsedUs)
+		result.Unattributed = int(resp.Unattributed)
+		for _, e := range resp.Entries {
+			result.Words = append(result.Words, ProfileWord{
+				Name:        e.Name,
+				Prim:        e.IsPrim,
+				Calls:       int(e.Calls),
+				InclusiveUs: int(e.InclusiveUs),
+				ExclusiveUs: int(e.ExclusiveUs),
+				Samples:     int(e.Samples),
+			})
+		}
+
+		if resp.NextSlot >= resp.SlotCount || resp.NextSlot <= next {
+			return result, nil
+		}
+		next = resp.NextSlot
+	}
+}
+
+// deviceMem sends a MEM_REQ and returns the heap census and high-water
+// marks. Only FROTH_MEM_STATS builds answer it; others reply with ERROR.
+func (d *Daemon) deviceMem() (*MemResult, error) {
+	d.portMu.Lock()
+	conn := d.conn
+	d.portMu.Unlock()
+	if conn == nil {
+		return nil, ErrDisconnected
+	}
+
+	d.reqMu.Lock()
+	defer d.reqMu.Unlock()
+
+	if err := d.attach(); err != nil {
+		return nil, fmt.Errorf("mem: %w", err)
+	}
+
+	seq := d.allocSeq()
+	ch := d.registerWaiter(seq, protocol.MemRes, false)
+	if err := d.sendFrame(protocol.MemReq, seq, nil); err != nil {
+		d.clearWaiter()
+		return nil, fmt.Errorf("write: %w", err)
+	}
+
+	header, respPayload, err := d.waitResponse(ch, commandTimeout)
+	if err != nil {
+		return nil, err
+	}
+
+	if header.MessageType == protocol.Error {
+		errResp, parseErr := protocol.ParseErrorResponse(respPayload)
+		if parseErr != nil {
+			return nil, parseErr
+		}
+		return nil, fmt.Errorf("device error (cat %d): %s", errResp.Category, errResp.Detail)
+	}
+
+	if header.MessageType != protocol.MemRes {
+		return nil, fmt.Errorf("unexpected response type: 0x%02x", header.MessageType)
+	}
+
+	resp, err := protocol.ParseMemResponse(respPayload)
+	if err != nil {
+		return nil, err
+	}
+
+	usage := func(u protocol.MemUsage) MemUsage {
+		return MemUsage{Now: int(u.Now), High: int(u.High), Capacity: int(u.Capacity)}
+	}
+	return &MemResult{
+		HeapSize:  int(resp.HeapSize),
+		HeapUsed:  int(resp.HeapUsed),
+		HeapHigh:  int(resp.HeapHigh),
+		Boot:      int(resp.Boot),
+		Restored:  int(resp.Restored),
+		Names:     int(resp.Names),
+		Quotes:    int(resp.Quotes),
+		Patterns:  int(resp.Patterns),
+		Strings:   int(resp.Strings),
+		Objects:   int(resp.Objects),
+		Unreached: int(resp.Unreached),
+		DS:        usage(resp.DS),
+		RS:        usage(resp.RS),
+		CS:        usage(resp.CS),
+		Tbuf:      usage(resp.Tbuf),
+		Tdesc:     usage(resp.Tdesc),
+	}, nil
+}
+
 // deviceReset sends a RESET_REQ and returns the parsed response.
 func (d *Daemon) deviceReset() (*ResetResult, error) {
 	d.portMu.Lock()
@@ -1472,6 +1612,14 @@ func msgTypeName(t byte) string {
 		return "INFO_REQ"
 	case protocol.InfoRes:
 		return "INFO_RES"
+	case protocol.ProfReq:
+		return "PROF_REQ"
+	case protocol.ProfRes:
+		return "PROF_RES"
+	case protocol.MemReq:
+		return "MEM_REQ"
+	case protocol.MemRes:
+		return "MEM_RES"
 	case protocol.ResetReq:
 		return "RESET_REQ"
 	case protocol.ResetRes:
@@ -85,6 +85,47 @@ type InfoResult struct {
 	Version          string `json:"version"`
 }
 
+type ProfileWord struct {
+	Name        string `json:"name"`
+	Prim        bool   `json:"prim"`
+	Calls       int    `json:"calls"`
+	InclusiveUs int    `json:"inclusive_us"`
+	ExclusiveUs int    `json:"exclusive_us"`
+	Samples     int    `json:"samples"`
+}
+
+type ProfileResult struct {
+	Active       bool          `json:"active"`
+	ElapsedUs    int           `json:"elapsed_us"`
+	Unattributed int           `json:"unattributed_samples"`
+	Words        []ProfileWord `json:"words"`
+}
+
+type MemUsage struct {
+	Now      int `json:"now"`
+	High     int `json:"high"`
+	Capacity int `json:"capacity"`
+}
+
+type MemResult struct {
+	HeapSize  int      `json:"heap_size"`
+	HeapUsed  int      `json:"heap_used"`
+	HeapHigh  int      `json:"heap_high"`
+	Boot      int      `json:"boot"`
+	Restored  int      `json:"restored"`
+	Names     int      `json:"names"`
+	Quotes    int      `json:"quotes"`
+	Patterns  int      `json:"patterns"`
+	Strings   int      `json:"strings"`
+	Objects   int      `json:"objects"`
+	Unreached int      `json:"unreached"`
+	DS        MemUsage `json:"ds"`
+	RS        MemUsage `json:"rs"`
+	CS        MemUsage `json:"cs"`
+	Tbuf      MemUsage `json:"tbuf"`
+	Tdesc     MemUsage `json:"tdesc"`
+}
+
 type ResetResult struct {
 	Status           int    `json:"status"`
 	HeapSize         int    `json:"heap_size"`
@@ -205,6 +246,10 @@ func (c *rpcConn) handleRequest(req *rpcRequest) {
 		go c.handleEval(req)
 	case "info":
 		c.handleInfo(req)
+	case "profile":
+		c.handleProfile(req)
+	case "mem":
+		c.handleMem(req)
 	case "status":
 		c.handleStatus(req)
 	case "reset":
@@ -253,6 +298,26 @@ func (c *rpcConn) handleInfo(req *rpcRequest) {
 	c.sendResult(req.ID, result)
 }
 
+func (c *rpcConn) handleProfile(req *rpcRequest) {
+	result, err := c.daemon.deviceProfile()
+	if err != nil {
+		c.sendError(req.ID, errDeviceError, err.Error())
+		return
+	}
+
+	c.sendResult(req.ID, result)
+}
+
+func (c *rpcConn) handleMem(req *rpcRequest) {
+	result, err := c.daemon.deviceMem()
+	if err != nil {
+		c.sendError(req.ID, errDeviceError, err.Error())
+		return
+	}
+
+	c.sendResult(req.ID, result)
+}
+
 func (c *rpcConn) handleReset(req *rpcRequest) {
 	result, err := c.daemon.deviceReset()
 	if err != nil {
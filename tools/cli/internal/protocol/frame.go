@@ -34,6 +34,10 @@ const (
 	InputData    = 0x0F
 	InputWait    = 0x10
 	OutputData   = 0x11
+	ProfReq      = 0x12 // FROTH_PROFILE builds only (ADR-058)
+	ProfRes      = 0x13
+	MemReq       = 0x14 // FROTH_MEM_STATS builds only (ADR-063)
+	MemRes       = 0x15
 	Error        = 0xFF
 )
 
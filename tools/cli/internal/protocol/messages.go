@@ -62,6 +62,20 @@ func ParseHelloResponse(p []byte) (*HelloResponse, error) {
 	return h, nil
 }
 
+// CapEvalStream is the HELLO_RES capability of a device that keeps one
+// source open across EVAL_REQs flagged EvalFlagMore (ADR-072).
+const CapEvalStream = 0x07
+
+// HasCapability reports whether the device listed capability id.
+func (h *HelloResponse) HasCapability(id uint8) bool {
+	for _, c := range h.Capabilities {
+		if c == id {
+			return true
+		}
+	}
+	return false
+}
+
 // GenerateSessionID returns a cryptographically random non-zero uint64.
 func GenerateSessionID() (uint64, error) {
 	for {
@@ -86,16 +100,24 @@ func ParseAttachResponse(payload []byte) (uint8, error) {
 
 // --- EVAL ---
 
-// BuildEvalPayload constructs an EVAL_REQ binary payload.
-func BuildEvalPayload(source string) []byte {
+// EvalFlagMore marks an EVAL_REQ whose source goes on in the next one.
+// Only for devices with CapEvalStream.
+const EvalFlagMore = 0x02
+
+// BuildEvalPayload constructs an EVAL_REQ binary payload. more sets
+// EvalFlagMore.
+func BuildEvalPayload(source string, more bool) []byte {
 	// Payload layout (from froth_link.c handle_eval):
-	//   u8   flags (0 for now)
+	//   u8   flags (bit 1: more)
 	//   u16  source_len
 	//   []   source bytes (raw UTF-8, NOT null-terminated)
 
 	src := []byte(source)
 	buf := make([]byte, 1+2+len(src))
 	buf[0] = 0 // flags
+	if more {
+		buf[0] |= EvalFlagMore
+	}
 	binary.LittleEndian.PutUint16(buf[1:3], uint16(len(src)))
 	copy(buf[3:], src)
 	return buf
@@ -247,6 +269,142 @@ func ParseResetResponse(p []byte) (*ResetResponse, error) {
 	return reset, nil
 }
 
+// --- PROF ---
+
+// BuildProfilePayload constructs a PROF_REQ payload: u16 first slot.
+func BuildProfilePayload(firstSlot uint16) []byte {
+	buf := make([]byte, 2)
+	binary.LittleEndian.PutUint16(buf, firstSlot)
+	return buf
+}
+
+// ProfileEntry holds the counters of one called word.
+type ProfileEntry struct {
+	Slot        uint16
+	IsPrim      bool
+	Name        string
+	Calls       uint32
+	InclusiveUs uint32
+	ExclusiveUs uint32
+	Samples     uint32
+}
+
+// ProfileResponse holds one page of a PROF_RES.
+type ProfileResponse struct {
+	Active       bool
+	ElapsedUs    uint32
+	Unattributed uint32
+	SlotCount    uint16
+	NextSlot     uint16 // equals SlotCount on the last page
+	Entries      []ProfileEntry
+}
+
+// ParseProfileResponse decodes a PROF_RES binary payload.
+func ParseProfileResponse(p []byte) (*ProfileResponse, error) {
+	// Payload layout (from froth_link.c handle_prof):
+	//   u8   flags (bit 0: profiling)
+	//   u32  elapsed_us
+	//   u32  unattributed_samples
+	//   u16  slot_count
+	//   u16  next_slot
+	//   u8   entry_count
+	//   entries: u16 slot, u8 is_prim, str name,
+	//            u32 calls, u32 inclusive_us, u32 exclusive_us, u32 samples
+
+	r := &payloadReader{data: p}
+
+	prof := &ProfileResponse{}
+	prof.Active = r.u8()&1 != 0
+	prof.ElapsedUs = r.u32()
+	prof.Unattributed = r.u32()
+	prof.SlotCount = r.u16()
+	prof.NextSlot = r.u16()
+	count := r.u8()
+	for i := 0; i < int(count) && r.err == nil; i++ {
+		var e ProfileEntry
+		e.Slot = r.u16()
+		e.IsPrim = r.u8() != 0
+		e.Name = r.str()
+		e.Calls = r.u32()
+		e.InclusiveUs = r.u32()
+		e.ExclusiveUs = r.u32()
+		e.Samples = r.u32()
+		prof.Entries = append(prof.Entries, e)
+	}
+
+	if r.err != nil {
+		return nil, fmt.Errorf("parse PROF_RES: %w", r.err)
+	}
+	return prof, nil
+}
+
+// --- MEM ---
+
+// MemUsage is the current use, high-water mark and capacity of one
+// fixed-size region.
+type MemUsage struct {
+	Now      uint16
+	High     uint16
+	Capacity uint16
+}
+
+// MemResponse holds a parsed MEM_RES payload.
+type MemResponse struct {
+	HeapSize  uint32
+	HeapUsed  uint32
+	HeapHigh  uint32
+	Boot      uint32
+	Restored  uint32
+	Names     uint32
+	Quotes    uint32
+	Patterns  uint32
+	Strings   uint32
+	Objects   uint32
+	Unreached uint32
+	DS        MemUsage
+	RS        MemUsage
+	CS        MemUsage
+	Tbuf      MemUsage
+	Tdesc     MemUsage
+}
+
+// ParseMemResponse decodes a MEM_RES binary payload.
+func ParseMemResponse(p []byte) (*MemResponse, error) {
+	// Payload layout (from froth_link.c handle_mem):
+	//   u32  heap_size, heap_used, heap_high
+	//   u32  boot, restored
+	//   u32  names, quotes, patterns, strings, unreached
+	//   u16  now, high, capacity for ds, rs, cs, tbuf, tdesc
+	//   u32  objects (absent from older firmware)
+
+	r := &payloadReader{data: p}
+
+	mem := &MemResponse{}
+	mem.HeapSize = r.u32()
+	mem.HeapUsed = r.u32()
+	mem.HeapHigh = r.u32()
+	mem.Boot = r.u32()
+	mem.Restored = r.u32()
+	mem.Names = r.u32()
+	mem.Quotes = r.u32()
+	mem.Patterns = r.u32()
+	mem.Strings = r.u32()
+	mem.Unreached = r.u32()
+	for _, u := range []*MemUsage{&mem.DS, &mem.RS, &mem.CS, &mem.Tbuf, &mem.Tdesc} {
+		u.Now = r.u16()
+		u.High = r.u16()
+		u.Capacity = r.u16()
+	}
+	if r.pos < len(r.data) {
+		mem.Objects = r.u32()
+	}
+
+	if r.err != nil {
+		return nil, fmt.Errorf("parse MEM_RES: %w", r.err)
+	}
+	return mem, nil
+}
+
 // --- ERROR ---
 
 // ErrorResponse holds a parsed ERROR payload.
@@ -148,3 +148,26 @@ func ChunkEvalSource(source string) ([]string, error) {
 	}
 	return chunks, nil
 }
+
+// SplitEvalStream cuts source into payload-sized pieces at any byte. A
+// device with protocol.CapEvalStream carries partial tokens, comments and
+// open brackets from one EVAL_REQ to the next, so no boundary needs care.
+func SplitEvalStream(source string) []string {
+	var chunks []string
+	for len(source) > maxEvalSource {
+		chunks = append(chunks, source[:maxEvalSource])
+		source = source[maxEvalSource:]
+	}
+	return append(chunks, source)
+}
+
+// EvalChunks returns the EVAL_REQ sources for source, and whether every
+// one but the last is sent with protocol.EvalFlagMore. Devices without
+// protocol.CapEvalStream get top-level line chunks.
+func EvalChunks(source string, hello *protocol.HelloResponse) ([]string, bool, error) {
+	if hello != nil && hello.HasCapability(protocol.CapEvalStream) {
+		return SplitEvalStream(source), true, nil
+	}
+	chunks, err := ChunkEvalSource(source)
+	return chunks, false, err
+}
@@ -3,6 +3,8 @@ package session
 import (
 	"strings"
 	"testing"
+
+	"github.com/nikokozak/froth/tools/cli/internal/protocol"
 )
 
 func TestChunkEvalSourceKeepsContent(t *testing.T) {
@@ -81,3 +83,34 @@ func TestChunkEvalSourceRejectsOversizedTopLevelForm(t *testing.T) {
 		t.Fatal("expected oversized form error")
 	}
 }
+
+func TestSplitEvalStreamCutsAnywhere(t *testing.T) {
+	source := strings.Repeat(`: s "a \" [ ( b" ;`+"\n", 40)
+
+	chunks := SplitEvalStream(source)
+	if len(chunks) < 2 {
+		t.Fatalf("expected multiple chunks, got %d", len(chunks))
+	}
+	if strings.Join(chunks, "") != source {
+		t.Fatal("chunk join mismatch")
+	}
+	for _, chunk := range chunks {
+		if len(chunk) > maxEvalSource {
+			t.Fatalf("chunk too large: %d", len(chunk))
+		}
+	}
+}
+
+func TestEvalChunksStreamsOnlyWithCapability(t *testing.T) {
+	// One line longer than a payload: only a streaming device can take it.
+	source := strings.Repeat("1 ", 200)
+
+	if _, _, err := EvalChunks(source, &protocol.HelloResponse{}); err == nil {
+		t.Fatal("expected an oversized line to fail without the capability")
+	}
+	hello := &protocol.HelloResponse{Capabilities: []uint8{protocol.CapEvalStream}}
+	chunks, stream, err := EvalChunks(source, hello)
+	if err != nil || !stream || len(chunks) != 2 {
+		t.Fatalf("expected 2 streamed chunks, got %d stream=%v err=%v", len(chunks), stream, err)
+	}
+}
@@ -429,23 +429,24 @@ func (s *Session) Reset() (*protocol.ResetResponse, error) {
 	}
 }
 
-// Eval sends Froth source for evaluation. Long source is chunked first.
+// Eval sends Froth source for evaluation. Long source is chunked first,
+// or streamed when the device supports it.
 func (s *Session) Eval(source string) (*protocol.EvalResponse, error) {
 	if err := s.attach(); err != nil {
 		return nil, fmt.Errorf("eval: %w", err)
 	}
 
-	chunks, err := ChunkEvalSource(source)
+	chunks, stream, err := EvalChunks(source, s.hello)
 	if err != nil {
 		return nil, err
 	}
 
 	var lastResp *protocol.EvalResponse
 
-	for _, chunk := range chunks {
+	for i, chunk := range chunks {
 		seq := s.allocSeq()
 		s.activeSeq = seq
-		payload := protocol.BuildEvalPayload(chunk)
+		payload := protocol.BuildEvalPayload(chunk, stream && i < len(chunks)-1)
 
 		if err := s.sendFrame(protocol.EvalReq, seq, payload); err != nil {
 			s.activeSeq = 0